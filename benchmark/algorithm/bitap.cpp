@@ -0,0 +1,243 @@
+#include <burst/algorithm/searching/bitap.hpp>
+#include <burst/algorithm/searching/flat_bitmask_map.hpp>
+#include <burst/algorithm/searching/parallel_find_all.hpp>
+#include <burst/algorithm/searching/simd_bitmask.hpp>
+
+#include <boost/algorithm/searching/boyer_moore.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+//!     Измерение скорости поиска.
+/*!
+        Функция поиска принимает начало и конец текста и возвращает начало первого вхождения
+    образца. Поиск повторяется с места, следующего за найденным вхождением, пока не будет
+    пройден весь текст. Время выводится в наносекундах на элемент текста.
+ */
+template <typename Container, typename Function>
+void test (const Container & text, Function search, const std::string & name)
+{
+    using namespace std::chrono;
+
+    std::size_t matches = 0;
+    auto start = steady_clock::now();
+    auto position = text.begin();
+    while ((position = search(position, text.end())) != text.end())
+    {
+        ++matches;
+        ++position;
+    }
+    auto time = steady_clock::now() - start;
+
+    std::cout << "\t" << name << ": "
+        << duration_cast<duration<double, std::nano>>(time).count() / static_cast<double>(text.size()) << " нс"
+        << " (" << matches << ")" << std::endl;
+}
+
+template <std::size_t Bits>
+void test_bitap (const std::string & text, const std::string & pattern)
+{
+    using iterator = std::string::const_iterator;
+
+    if (pattern.size() > Bits)
+    {
+        return;
+    }
+
+    const burst::algorithm::bitap<char, std::bitset<Bits>> bitset(pattern);
+    test(text, [& bitset] (iterator first, iterator last) { return bitset(first, last); },
+        "bitap<std::bitset<" + std::to_string(Bits) + ">>");
+
+    const burst::algorithm::bitap<char, burst::algorithm::simd_bitmask<Bits>> simd(pattern);
+    test(text, [& simd] (iterator first, iterator last) { return simd(first, last); },
+        "bitap<simd_bitmask<" + std::to_string(Bits) + ">>");
+}
+
+//!     Измерение скорости параллельного поиска всех вхождений.
+/*!
+        Сравнивает поиск всех вхождений в одном потоке с поиском в заданном количестве потоков.
+ */
+void test_parallel (const std::string & text, const std::string & pattern, std::size_t thread_count)
+{
+    using namespace std::chrono;
+
+    const burst::algorithm::bitap<char, std::uint64_t> search(pattern);
+    for (auto threads: {std::size_t{1}, thread_count})
+    {
+        auto start = steady_clock::now();
+        const auto matches = burst::algorithm::parallel_find_all(search, text, threads);
+        auto time = steady_clock::now() - start;
+
+        std::cout << "\tparallel_find_all, потоков " << threads << ": "
+            << duration_cast<duration<double, std::nano>>(time).count() / static_cast<double>(text.size()) << " нс"
+            << " (" << matches.size() << ")" << std::endl;
+    }
+}
+
+void test_pattern (const std::string & text, const std::string & pattern, std::size_t thread_count)
+{
+    using iterator = std::string::const_iterator;
+
+    std::cout << "Длина образца: " << pattern.size() << std::endl;
+
+    if (pattern.size() <= 64)
+    {
+        const burst::algorithm::bitap<char, std::uint64_t> word(pattern);
+        test(text, [& word] (iterator first, iterator last) { return word(first, last); },
+            "bitap<std::uint64_t>");
+
+        if (thread_count > 1)
+        {
+            test_parallel(text, pattern, thread_count);
+        }
+    }
+    test_bitap<128>(text, pattern);
+    test_bitap<256>(text, pattern);
+    test_bitap<512>(text, pattern);
+
+    const boost::algorithm::boyer_moore<iterator> boyer_moore(pattern.begin(), pattern.end());
+    test(text, [& boyer_moore] (iterator first, iterator last) { return boyer_moore(first, last).first; },
+        "boost::algorithm::boyer_moore");
+
+    test(text,
+        [& pattern] (iterator first, iterator last)
+        {
+            return std::search(first, last, pattern.begin(), pattern.end());
+        },
+        "std::search");
+
+    std::cout << std::endl;
+}
+
+//!     Поиск в последовательности целочисленных лексем.
+/*!
+        Сравнивает таблицы масок для элементов шире байта: плоскую хеш-таблицу, которая
+    выбирается по умолчанию, std::map и std::unordered_map.
+ */
+void test_tokens (const std::vector<std::uint32_t> & text, const std::vector<std::uint32_t> & pattern)
+{
+    using iterator = std::vector<std::uint32_t>::const_iterator;
+    using bitmask_type = std::uint64_t;
+
+    std::cout << "Лексемы, длина образца: " << pattern.size() << std::endl;
+
+    const burst::algorithm::bitap<std::uint32_t, bitmask_type> flat(pattern);
+    test(text, [& flat] (iterator first, iterator last) { return flat(first, last); },
+        "bitap<flat_bitmask_map>");
+
+    const burst::algorithm::bitap<std::uint32_t, bitmask_type, std::map<std::uint32_t, bitmask_type>> tree(pattern);
+    test(text, [& tree] (iterator first, iterator last) { return tree(first, last); },
+        "bitap<std::map>");
+
+    const burst::algorithm::bitap<std::uint32_t, bitmask_type, std::unordered_map<std::uint32_t, bitmask_type>> hash(pattern);
+    test(text, [& hash] (iterator first, iterator last) { return hash(first, last); },
+        "bitap<std::unordered_map>");
+
+    test(text,
+        [& pattern] (iterator first, iterator last)
+        {
+            return std::search(first, last, pattern.begin(), pattern.end());
+        },
+        "std::search");
+
+    std::cout << std::endl;
+}
+
+std::string random_text (std::default_random_engine & engine, std::size_t size, std::size_t alphabet)
+{
+    std::uniform_int_distribution<int> letter('a', static_cast<int>('a' + alphabet - 1));
+    std::string text(size, 'a');
+    std::generate(text.begin(), text.end(), [&] () { return static_cast<char>(letter(engine)); });
+    return text;
+}
+
+std::vector<std::uint32_t> random_tokens (std::default_random_engine & engine, std::size_t size, std::size_t tokens)
+{
+    // Значения лексем разрежены, как идентификаторы в словаре, а не идут подряд с нуля.
+    std::uniform_int_distribution<std::uint32_t> token(0, static_cast<std::uint32_t>(tokens - 1));
+    std::vector<std::uint32_t> text(size);
+    std::generate(text.begin(), text.end(), [&] () { return token(engine) * 2654435761u; });
+    return text;
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("size", bpo::value<std::size_t>()->default_value(10000000), "Длина текста")
+        ("alphabet", bpo::value<std::size_t>()->default_value(4), "Размер алфавита текста и образцов")
+        ("pattern", bpo::value<std::vector<std::size_t>>()->multitoken()
+            ->default_value(std::vector<std::size_t>{16, 64, 100, 256, 500}, "16 64 100 256 500"),
+            "Набор длин образцов")
+        ("tokens", bpo::value<std::size_t>()->default_value(0),
+            "Искать в последовательности 32-битных лексем из заданного количества различных "
+            "значений вместо поиска в строке")
+        ("threads", bpo::value<std::size_t>()->default_value(std::thread::hardware_concurrency()),
+            "Количество потоков для параллельного поиска всех вхождений");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            const auto alphabet = std::min<std::size_t>(std::max<std::size_t>(vm["alphabet"].as<std::size_t>(), 1), 26);
+
+            const auto tokens = vm["tokens"].as<std::size_t>();
+            const auto threads = vm["threads"].as<std::size_t>();
+
+            std::default_random_engine engine;
+            if (tokens > 0)
+            {
+                const auto text = random_tokens(engine, vm["size"].as<std::size_t>(), tokens);
+                for (auto length: vm["pattern"].as<std::vector<std::size_t>>())
+                {
+                    if (length > 0 && length <= 64 && length <= text.size())
+                    {
+                        const auto offset = std::uniform_int_distribution<std::size_t>(0, text.size() - length)(engine);
+                        const auto pattern_begin = text.begin() + static_cast<std::ptrdiff_t>(offset);
+                        test_tokens(text, std::vector<std::uint32_t>(pattern_begin, pattern_begin + static_cast<std::ptrdiff_t>(length)));
+                    }
+                }
+            }
+            else
+            {
+                const auto text = random_text(engine, vm["size"].as<std::size_t>(), alphabet);
+                for (auto length: vm["pattern"].as<std::vector<std::size_t>>())
+                {
+                    if (length > 0 && length <= text.size())
+                    {
+                        // Образец — кусок текста, поэтому в тексте есть хотя бы одно вхождение.
+                        const auto offset = std::uniform_int_distribution<std::size_t>(0, text.size() - length)(engine);
+                        test_pattern(text, text.substr(offset, length), threads);
+                    }
+                }
+            }
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
@@ -0,0 +1,144 @@
+#include <burst/algorithm/searching/bitap.hpp>
+#include <burst/algorithm/searching/byte_class.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Реализация регулярных выражений в libstdc++ вызывает ложное предупреждение о
+// неинициализированной переменной, которое при сборке с -Werror становится ошибкой.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <regex>
+#pragma GCC diagnostic pop
+
+//!     Измерение скорости поиска.
+/*!
+        Функция поиска принимает начало и конец текста и возвращает начало первого вхождения
+    образца. Поиск повторяется с места, следующего за найденным вхождением, пока не будет
+    пройден весь текст. Время выводится в наносекундах на байт текста.
+ */
+template <typename Function>
+void test (const std::string & text, Function search, const std::string & name)
+{
+    using namespace std::chrono;
+
+    std::size_t matches = 0;
+    auto start = steady_clock::now();
+    auto position = text.begin();
+    while ((position = search(position, text.end())) != text.end())
+    {
+        ++matches;
+        ++position;
+    }
+    auto time = steady_clock::now() - start;
+
+    std::cout << "\t" << name << ": "
+        << duration_cast<duration<double, std::nano>>(time).count() / static_cast<double>(text.size()) << " нс"
+        << " (" << matches << ")" << std::endl;
+}
+
+void test_expression (const std::string & text, const std::string & expression)
+{
+    using iterator = std::string::const_iterator;
+
+    std::cout << "Образец: " << expression << std::endl;
+
+    const burst::algorithm::bitap<char, std::uint64_t> bitap(burst::algorithm::make_byte_class_pattern(expression));
+    test(text, [& bitap] (iterator first, iterator last) { return bitap(first, last); },
+        "bitap<std::uint64_t>");
+
+    const std::regex regex(expression, std::regex::optimize);
+    test(text,
+        [& regex] (iterator first, iterator last)
+        {
+            std::smatch match;
+            return std::regex_search(first, last, match, regex) ? match[0].first : last;
+        },
+        "std::regex_search");
+
+    std::cout << std::endl;
+}
+
+//!     Текст, похожий на журнал событий.
+/*!
+        Каждая строка — время, уровень важности, имя компонента и код ответа:
+
+        12:34:56 WARN worker-7 code=404
+ */
+std::string random_log (std::default_random_engine & engine, std::size_t size)
+{
+    const std::vector<std::string> levels{"DEBUG", "INFO", "WARN", "ERROR"};
+    const std::vector<std::string> components{"worker", "router", "storage", "cache"};
+
+    std::discrete_distribution<std::size_t> level{40, 40, 15, 5};
+    std::uniform_int_distribution<std::size_t> component(0, components.size() - 1);
+    std::uniform_int_distribution<int> number(0, 59);
+    std::uniform_int_distribution<int> code(100, 599);
+
+    std::string text;
+    text.reserve(size + 64);
+    while (text.size() < size)
+    {
+        const auto two_digits = [] (int n) { return std::string(n < 10 ? "0" : "") + std::to_string(n); };
+        text += two_digits(number(engine) % 24) + ":" + two_digits(number(engine)) + ":" + two_digits(number(engine));
+        text += " " + levels[level(engine)];
+        text += " " + components[component(engine)] + "-" + std::to_string(number(engine) % 10);
+        text += " code=" + std::to_string(code(engine)) + "\n";
+    }
+    return text;
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("size", bpo::value<std::size_t>()->default_value(10000000), "Длина текста")
+        ("expression", bpo::value<std::vector<std::string>>()->multitoken()
+            ->default_value
+            (
+                std::vector<std::string>{"code=5[0-9][0-9]", "[0-9][0-9]:[0-5]9:00 WARN", "ERROR cache-. code=4.."},
+                "\"code=5[0-9][0-9]\" ..."
+            ),
+            "Набор образцов с классами байтов");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            std::default_random_engine engine;
+            const auto text = random_log(engine, vm["size"].as<std::size_t>());
+            for (const auto & expression: vm["expression"].as<std::vector<std::string>>())
+            {
+                test_expression(text, expression);
+            }
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+    catch (std::invalid_argument & e)
+    {
+        std::cout << e.what() << std::endl;
+    }
+}
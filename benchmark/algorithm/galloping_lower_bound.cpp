@@ -4,34 +4,116 @@
 #include <boost/program_options.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <random>
+#include <string>
+#include <utility>
 #include <vector>
 
+using query_type = std::pair<std::size_t, std::int64_t>;
+
+//!     Измерение времени поиска.
+/*!
+        Каждый запрос — это начало диапазона поиска и искомое значение. Концом диапазона всегда
+    служит конец массива.
+ */
 template <typename Container, typename Function>
-void test (const Container & numbers, std::size_t attempts, Function lower_bound, const std::string & name)
+void test (const Container & numbers, const std::vector<query_type> & queries, Function lower_bound, const std::string & name)
+{
+    using namespace std::chrono;
+
+    std::size_t checksum = 0;
+    auto start = steady_clock::now();
+    for (const auto & query: queries)
+    {
+        const auto search_start = numbers.begin() + static_cast<typename Container::difference_type>(query.first);
+        checksum += static_cast<std::size_t>(lower_bound(search_start, numbers.end(), query.second) - search_start);
+    }
+    auto time = steady_clock::now() - start;
+
+    std::cout << "\t" << name << ": "
+        << duration_cast<duration<double, std::nano>>(time).count() / static_cast<double>(queries.size()) << " нс"
+        << " (" << checksum << ")" << std::endl;
+}
+
+//!     Запросы с заданным расстоянием скачка.
+/*!
+        Искомый элемент отстоит от начала поиска на случайное расстояние из [0, 2 * distance), то
+    есть в среднем на distance. Если distance равно нулю, то расстояние выбирается из
+    [0, sqrt(M)), где M — расстояние от начала поиска до конца массива.
+        Начало поиска либо выбирается случайно, либо, если задан флаг "walk", совпадает с
+    найденным элементом предыдущего запроса, как при пересечении упорядоченных диапазонов.
+ */
+template <typename Container>
+std::vector<query_type> make_queries (const Container & numbers, std::size_t attempts, std::size_t distance, bool walk)
 {
-    clock_t total_time = 0;
+    std::default_random_engine engine;
+    std::uniform_int_distribution<std::size_t> uniform_start(0, numbers.size() - 1);
 
+    std::vector<query_type> queries;
+    queries.reserve(attempts);
+    std::size_t previous = 0;
     for (std::size_t attempt = 0; attempt < attempts; ++attempt)
     {
-        using difference_type = typename Container::difference_type;
-        auto search_start = numbers.begin() + random() % static_cast<difference_type>(numbers.size() - 1);
-        auto search_position = static_cast<std::size_t>(std::sqrt(std::distance(search_start, numbers.end())));
-        auto search_element = search_start + random() % static_cast<difference_type>(search_position);
-        auto number = *search_element;
-
-        clock_t attempt_time = clock();
-        lower_bound(search_start, numbers.end(), number);
-        attempt_time = clock() - attempt_time;
-        total_time += attempt_time;
+        const auto start = walk ? previous : uniform_start(engine);
+        const auto rest = numbers.size() - start;
+        const auto limit = distance == 0
+            ? static_cast<std::size_t>(std::sqrt(static_cast<double>(rest)))
+            : 2 * distance;
+        const auto offset = std::uniform_int_distribution<std::size_t>(0, std::max<std::size_t>(limit, 1) - 1)(engine);
+        const auto target = std::min(start + offset, numbers.size() - 1);
+        queries.emplace_back(start, numbers[target]);
+        previous = target + 1 < numbers.size() ? target : 0;
     }
 
-    std::cout << name << ":" << std::endl;
-    std::cout << "\tОбщее время: " << static_cast<double>(total_time) / CLOCKS_PER_SEC << std::endl;
-    std::cout << "\tСреднее время: " << static_cast<double>(total_time) / static_cast<double>(attempts) / CLOCKS_PER_SEC << std::endl;
+    return queries;
+}
+
+void test_distance (const std::vector<std::int64_t> & numbers, std::size_t attempts, std::size_t distance, bool walk)
+{
+    using iterator = std::vector<std::int64_t>::const_iterator;
+
+    std::cout << (walk ? "Последовательный обход" : "Случайное начало") << ", расстояние: ";
+    if (distance == 0)
+    {
+        std::cout << "sqrt" << std::endl;
+    }
+    else
+    {
+        std::cout << distance << std::endl;
+    }
+
+    const auto queries = make_queries(numbers, attempts, distance, walk);
+    test(numbers, queries, &burst::galloping_lower_bound<iterator, std::int64_t>, "gallop");
+    test(numbers, queries,
+        [] (iterator first, iterator last, std::int64_t value)
+        {
+            // Произвольное отношение порядка отключает ускоренный вариант для целых чисел.
+            return burst::galloping_lower_bound(first, last, value, [] (auto x, auto y) { return x < y; });
+        },
+        "gallop (общий)");
+    test(numbers, queries, &std::lower_bound<iterator, std::int64_t>, "std::lower_bound");
+    if (distance != 0 && distance <= 256)
+    {
+        test(numbers, queries, &std::find<iterator, std::int64_t>, "std::find");
+    }
     std::cout << std::endl;
 }
 
+void test_all (const std::vector<std::int64_t> & numbers, std::size_t attempts, const std::vector<std::size_t> & distances)
+{
+    for (auto walk: {false, true})
+    {
+        for (auto distance: distances)
+        {
+            test_distance(numbers, attempts, distance, walk);
+        }
+    }
+}
+
 int main (int argc, const char * argv[])
 {
     namespace bpo = boost::program_options;
@@ -39,7 +121,14 @@ int main (int argc, const char * argv[])
     bpo::options_description description("Опции");
     description.add_options()
         ("help,h", "Подсказка")
-        ("attempts", bpo::value<std::size_t>()->default_value(1000), "Количество испытаний");
+        ("attempts", bpo::value<std::size_t>()->default_value(1000), "Количество испытаний")
+        ("generate", bpo::value<std::size_t>()->default_value(0),
+            "Породить упорядоченный массив заданного размера из случайных чисел вместо чтения со "
+            "стандартного входа")
+        ("distance", bpo::value<std::vector<std::size_t>>()->multitoken()
+            ->default_value(std::vector<std::size_t>{0, 1, 4, 16, 64, 256, 4096, 65536}, "0 1 4 16 64 256 4096 65536"),
+            "Набор средних расстояний от начала поиска до искомого элемента. Ноль означает "
+            "квадратный корень из длины диапазона.");
 
     try
     {
@@ -54,12 +143,22 @@ int main (int argc, const char * argv[])
         else
         {
             std::vector<std::int64_t> numbers;
-            read(std::cin, numbers);
+            const auto generate = vm["generate"].as<std::size_t>();
+            if (generate > 0)
+            {
+                std::default_random_engine engine;
+                std::uniform_int_distribution<std::int64_t> uniform;
+                numbers.resize(generate);
+                std::generate(numbers.begin(), numbers.end(), [&] () { return uniform(engine); });
+                std::sort(numbers.begin(), numbers.end());
+            }
+            else
+            {
+                read(std::cin, numbers);
+            }
 
             std::size_t attempts = vm["attempts"].as<std::size_t>();
-            test(numbers, attempts, &burst::galloping_lower_bound<std::vector<std::int64_t>::const_iterator, std::int64_t>, "gallop");
-            test(numbers, attempts, &std::lower_bound<std::vector<std::int64_t>::const_iterator, std::int64_t>, "std::lower_bound");
-            test(numbers, attempts, &std::find<std::vector<std::int64_t>::const_iterator, std::int64_t>, "std::find");
+            test_all(numbers, attempts, vm["distance"].as<std::vector<std::size_t>>());
         }
     }
     catch (bpo::error & e)
@@ -0,0 +1,134 @@
+#include <burst/algorithm/searching/bitap.hpp>
+#include <burst/algorithm/searching/swar_bitap.hpp>
+
+#include <boost/algorithm/searching/boyer_moore_horspool.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+//!     Измерение скорости поиска.
+/*!
+        Функция поиска принимает начало и конец текста и возвращает начало первого вхождения
+    образца. Поиск повторяется с места, следующего за найденным вхождением, пока не будет
+    пройден весь текст. Выводится время в наносекундах на байт текста и пропускная способность.
+ */
+template <typename Function>
+void test (const std::string & text, Function search, const std::string & name)
+{
+    using namespace std::chrono;
+
+    std::size_t matches = 0;
+    auto start = steady_clock::now();
+    auto position = text.data();
+    const auto end = text.data() + text.size();
+    while ((position = search(position, end)) != end)
+    {
+        ++matches;
+        ++position;
+    }
+    auto time = duration_cast<duration<double>>(steady_clock::now() - start).count();
+
+    std::cout << "\t" << name << ": "
+        << time * 1e9 / static_cast<double>(text.size()) << " нс, "
+        << static_cast<double>(text.size()) / time / (1u << 30) << " ГБ/с"
+        << " (" << matches << ")" << std::endl;
+}
+
+void test_pattern (const std::string & text, const std::string & pattern)
+{
+    using iterator = const char *;
+
+    std::cout << "Длина образца: " << pattern.size() << std::endl;
+
+    const burst::algorithm::bitap<char, std::uint64_t> bitap(pattern);
+    test(text, [& bitap] (iterator first, iterator last) { return bitap(first, last); },
+        "bitap<std::uint64_t>");
+
+    const burst::algorithm::swar_bitap<char> swar_bitap(pattern);
+    test(text, [& swar_bitap] (iterator first, iterator last) { return swar_bitap(first, last); },
+        "swar_bitap");
+
+    test(text,
+        [& pattern] (iterator first, iterator last)
+        {
+            const auto match = memmem(first, static_cast<std::size_t>(last - first), pattern.data(), pattern.size());
+            return match != nullptr ? static_cast<iterator>(match) : last;
+        },
+        "memmem");
+
+    const boost::algorithm::boyer_moore_horspool<iterator> horspool(pattern.data(), pattern.data() + pattern.size());
+    test(text, [& horspool] (iterator first, iterator last) { return horspool(first, last).first; },
+        "boost::algorithm::boyer_moore_horspool");
+
+    test(text,
+        [& pattern] (iterator first, iterator last)
+        {
+            return std::search(first, last, pattern.begin(), pattern.end());
+        },
+        "std::search");
+
+    std::cout << std::endl;
+}
+
+std::string random_text (std::default_random_engine & engine, std::size_t size, std::size_t alphabet)
+{
+    std::uniform_int_distribution<int> letter('a', static_cast<int>('a' + alphabet - 1));
+    std::string text(size, 'a');
+    std::generate(text.begin(), text.end(), [&] () { return static_cast<char>(letter(engine)); });
+    return text;
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("size", bpo::value<std::size_t>()->default_value(100000000), "Длина текста")
+        ("alphabet", bpo::value<std::size_t>()->default_value(16), "Размер алфавита текста и образцов")
+        ("pattern", bpo::value<std::vector<std::size_t>>()->multitoken()
+            ->default_value(std::vector<std::size_t>{4, 8, 16, 32}, "4 8 16 32"),
+            "Набор длин образцов (не более 32)");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            const auto alphabet = std::min<std::size_t>(std::max<std::size_t>(vm["alphabet"].as<std::size_t>(), 1), 26);
+
+            std::default_random_engine engine;
+            const auto text = random_text(engine, vm["size"].as<std::size_t>(), alphabet);
+            for (auto length: vm["pattern"].as<std::vector<std::size_t>>())
+            {
+                if (length > 0 && length <= burst::algorithm::swar_bitap<char>::max_length && length <= text.size())
+                {
+                    // Образец — кусок текста, поэтому в тексте есть хотя бы одно вхождение.
+                    const auto offset = std::uniform_int_distribution<std::size_t>(0, text.size() - length)(engine);
+                    test_pattern(text, text.substr(offset, length));
+                }
+            }
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
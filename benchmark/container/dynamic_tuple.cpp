@@ -1,4 +1,5 @@
 #include <burst/container/dynamic_tuple.hpp>
+#include <burst/container/schema_tuple.hpp>
 
 #include <boost/program_options.hpp>
 
@@ -10,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <random>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -153,6 +155,108 @@ void test_pointer_array_access
     std::cout << type << ' ' << time << std::endl;
 }
 
+//!     Измерение скорости наполнения кортежа и его копирования.
+/*!
+        Наполнение начинается с пустого кортежа, поэтому включает в себя все перевыделения
+    памяти, которые происходят по мере роста кортежа.
+ */
+template <typename T>
+void test_dyntuple_growth_and_copy (std::size_t size, std::size_t attempt_count, const std::string & name)
+{
+    using namespace std::chrono;
+
+    std::size_t total = 0;
+
+    auto start_time = steady_clock::now();
+    for (std::size_t attempt = 0; attempt < attempt_count; ++attempt)
+    {
+        total += create_dynamic_tuple<T>(size).volume();
+    }
+    auto growth_time = duration_cast<duration<double>>(steady_clock::now() - start_time).count();
+
+    const auto tuple = create_dynamic_tuple<T>(size);
+    start_time = steady_clock::now();
+    for (std::size_t attempt = 0; attempt < attempt_count; ++attempt)
+    {
+        const auto copy = tuple;
+        total += copy.volume();
+    }
+    auto copy_time = duration_cast<duration<double>>(steady_clock::now() - start_time).count();
+
+    std::clog << total << std::endl;
+    std::cout << name << "::push_back " << growth_time << std::endl;
+    std::cout << name << "::copy " << copy_time << std::endl;
+}
+
+//!     Измерение работы с большим количеством строк одинакового состава.
+/*!
+        Сравнивает строки-кортежи dynamic_tuple, каждый из которых хранит описание своих
+    объектов, и строки schema_tuple, которые разделяют одну схему. Измеряется время создания
+    всех строк, их копирования и суммирования одного поля всех строк.
+ */
+template <typename Row, typename Create>
+void test_rows (std::size_t size, std::size_t attempt_count, Create create, const std::string & name)
+{
+    using namespace std::chrono;
+
+    double creation_time = 0;
+    double copy_time = 0;
+    double access_time = 0;
+    std::size_t total = 0;
+
+    for (std::size_t attempt = 0; attempt < attempt_count; ++attempt)
+    {
+        auto start_time = steady_clock::now();
+        std::vector<Row> rows;
+        rows.reserve(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            rows.push_back(create(i));
+        }
+        creation_time += duration_cast<duration<double>>(steady_clock::now() - start_time).count();
+
+        start_time = steady_clock::now();
+        const auto copy = rows;
+        copy_time += duration_cast<duration<double>>(steady_clock::now() - start_time).count();
+
+        start_time = steady_clock::now();
+        for (const auto & row: copy)
+        {
+            total += row.template get<std::size_t>(0);
+        }
+        access_time += duration_cast<duration<double>>(steady_clock::now() - start_time).count();
+    }
+
+    std::clog << total << std::endl;
+    std::cout << name << "::create " << creation_time << std::endl;
+    std::cout << name << "::copy " << copy_time << std::endl;
+    std::cout << name << "::get " << access_time << std::endl;
+}
+
+void test_rows (std::size_t size, std::size_t attempt_count)
+{
+    test_rows<burst::dynamic_tuple>(size, attempt_count,
+        [] (std::size_t i) { return burst::dynamic_tuple(i, static_cast<double>(i), 'a'); },
+        "dynamic_tuple");
+
+    const auto schema = burst::make_dynamic_tuple_schema<std::size_t, double, char>();
+    test_rows<burst::schema_tuple>(size, attempt_count,
+        [& schema] (std::size_t i) { return burst::schema_tuple(schema, i, static_cast<double>(i), 'a'); },
+        "schema_tuple");
+}
+
+//!     Тип, который не является тривиально копируемым, для сравнения.
+struct B
+{
+    B () = default;
+    B (const B & that):
+        x(that.x)
+    {
+    }
+
+    std::size_t x = 0;
+};
+
 int main (int argc, const char * argv[])
 {
     namespace bpo = boost::program_options;
@@ -170,7 +274,9 @@ int main (int argc, const char * argv[])
             "Степень разреженности массива указателей.\n"
             "Создаёт массив указателей размера `size * spread`, который затем, в зависимости от "
             "выбранного типа массива, либо прореживается, либо перемешивается.\n"
-            "В случае с простым (plain) массивом опция игнорируется.");
+            "В случае с простым (plain) массивом опция игнорируется.")
+        ("copy", "Измерить скорость наполнения и копирования кортежа вместо скорости доступа.")
+        ("rows", "Сравнить строки dynamic_tuple и строки schema_tuple с общей схемой.");
 
     try
     {
@@ -186,14 +292,25 @@ int main (int argc, const char * argv[])
         {
             auto size = vm["size"].as<std::size_t>();
             auto attempts = vm["attempts"].as<std::size_t>();
-            auto types = vm["type"].as<std::vector<std::string>>();
             auto spread = vm["spread"].as<std::size_t>();
 
-            test_dyntuple_access(size, attempts);
-            test_vector_access(size, attempts);
-            for (const auto & type: types)
+            if (vm.count("rows"))
+            {
+                test_rows(size, attempts);
+            }
+            else if (vm.count("copy"))
+            {
+                test_dyntuple_growth_and_copy<A>(size, attempts, "trivial");
+                test_dyntuple_growth_and_copy<B>(size, attempts, "non-trivial");
+            }
+            else
             {
-                test_pointer_array_access(size, attempts, type, spread);
+                test_dyntuple_access(size, attempts);
+                test_vector_access(size, attempts);
+                for (const auto & type: vm["type"].as<std::vector<std::string>>())
+                {
+                    test_pointer_array_access(size, attempts, type, spread);
+                }
             }
         }
     }
@@ -1,12 +1,24 @@
+#include <burst/container/eytzinger_layout.hpp>
+#include <burst/container/k_ary_image.hpp>
+#include <burst/container/k_ary_layout.hpp>
 #include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/s_tree_layout.hpp>
+#include <burst/container/static_k_ary_search_set.hpp>
+#include <burst/container/static_search_set.hpp>
 #include <io.hpp>
 
 #include <boost/container/flat_set.hpp>
 #include <boost/program_options.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <random>
 #include <set>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -28,70 +40,283 @@ struct default_constructor
     std::string name;
 };
 
-template <typename Value>
+template <typename Value, typename NodeStorage = burst::container::packed_nodes>
 struct k_ary_constructor
 {
-    k_ary_constructor (std::size_t arity):
-        arity(arity)
+    k_ary_constructor (std::size_t arity, const std::string & suffix = ""):
+        arity(arity),
+        suffix(suffix)
     {
     }
 
     template <typename Iterator>
-    burst::k_ary_search_set<Value> operator () (Iterator first, Iterator last) const
+    burst::k_ary_search_set<Value, std::less<Value>, NodeStorage> operator () (Iterator first, Iterator last) const
     {
-        std::cout << "k_ary_set(" << arity << ")" << std::endl;
-        return burst::k_ary_search_set<Value>(first, last, arity);
+        std::cout << "k_ary_set(" << arity << suffix << ")" << std::endl;
+        return burst::k_ary_search_set<Value, std::less<Value>, NodeStorage>(first, last, arity);
     }
 
     std::size_t arity;
+    std::string suffix;
 };
 
+template <typename Value, std::size_t Arity>
+struct static_k_ary_constructor
+{
+    template <typename Iterator>
+    burst::static_k_ary_search_set<Value, Arity> operator () (Iterator first, Iterator last) const
+    {
+        std::cout << "static_k_ary_set(" << Arity << ")" << std::endl;
+        return burst::static_k_ary_search_set<Value, Arity>(first, last);
+    }
+};
+
+template <typename Value, typename Layout>
+struct static_search_constructor
+{
+    static_search_constructor (const std::string & name):
+        name(name)
+    {
+    }
+
+    template <typename Iterator>
+    burst::static_search_set<Value, Layout> operator () (Iterator first, Iterator last) const
+    {
+        std::cout << "static_search_set(" << name << ")" << std::endl;
+        return burst::static_search_set<Value, Layout>(burst::container::unique_ordered_tag, first, last);
+    }
+
+    std::string name;
+};
+
+//!     Измерение времени поиска.
+/*!
+        Каждый следующий искомый элемент выбирается в зависимости от результата предыдущего
+    поиска, поэтому процессор не может выполнять несколько поисков одновременно, и измеряется
+    именно задержка одного поиска, а не пропускная способность.
+ */
 template <typename Container, typename SetConstructor>
 void test_one (const Container & numbers, std::size_t attempt_count, const SetConstructor & constructor)
 {
-    clock_t creation_time = clock();
+    using namespace std::chrono;
+
+    auto creation_start = steady_clock::now();
     auto set = constructor(numbers.begin(), numbers.end());
-    creation_time = clock() - creation_time;
+    auto creation_time = steady_clock::now() - creation_start;
 
-    clock_t search_time = 0;
+    std::uint64_t position = 0;
+    auto search_start = steady_clock::now();
     for (std::size_t attempt = 0; attempt < attempt_count; ++attempt)
     {
-        const auto & element = numbers[static_cast<std::size_t>(random()) % numbers.size()];
+        const auto & element = numbers[position];
 
-        clock_t attempt_time = clock();
         auto search_result = set.find(element);
-        attempt_time = clock() - attempt_time;
-
         if (search_result == set.end() || *search_result != element)
         {
             throw std::runtime_error("Нашлись не все искомые элементы.");
         }
 
-        search_time += attempt_time;
+        position = (static_cast<std::uint64_t>(*search_result) * 0x9e3779b97f4a7c15ull + attempt) % numbers.size();
     }
+    auto search_time = steady_clock::now() - search_start;
 
-    std::cout << "\tВремя создания: " << static_cast<double>(creation_time) / CLOCKS_PER_SEC << std::endl;
-    std::cout << "\tСреднее время поиска: " << static_cast<double>(search_time) / static_cast<double>(attempt_count) / CLOCKS_PER_SEC << std::endl;
+    std::cout << "\tВремя создания: " << duration_cast<duration<double>>(creation_time).count() << std::endl;
+    std::cout << "\tСреднее время поиска (нс): " << duration_cast<duration<double, std::nano>>(search_time).count() / static_cast<double>(attempt_count) << std::endl;
     std::cout << std::endl;
 }
 
+//!     Измерение пропускной способности поиска.
+/*!
+        Искомые элементы не зависят друг от друга. Сравнивается поиск по одному элементу с
+    помощью find и групповой поиск с помощью find_batch.
+ */
+template <typename Container, typename SetConstructor>
+void test_throughput (const Container & numbers, std::size_t attempt_count, const SetConstructor & constructor)
+{
+    using namespace std::chrono;
+
+    auto set = constructor(numbers.begin(), numbers.end());
+
+    std::default_random_engine engine;
+    std::uniform_int_distribution<std::size_t> uniform(0, numbers.size() - 1);
+    std::vector<typename Container::value_type> keys(attempt_count);
+    std::generate(keys.begin(), keys.end(), [&] () { return numbers[uniform(engine)]; });
+
+    typename Container::value_type one_by_one_sum = 0;
+    auto one_by_one_start = steady_clock::now();
+    for (const auto & key: keys)
+    {
+        one_by_one_sum += *set.find(key);
+    }
+    auto one_by_one_time = steady_clock::now() - one_by_one_start;
+
+    std::vector<typename decltype(set)::const_iterator> found(keys.size());
+    typename Container::value_type batch_sum = 0;
+    auto batch_start = steady_clock::now();
+    set.find_batch(keys.begin(), keys.end(), found.begin());
+    for (const auto & result: found)
+    {
+        batch_sum += *result;
+    }
+    auto batch_time = steady_clock::now() - batch_start;
+
+    if (one_by_one_sum != batch_sum)
+    {
+        throw std::runtime_error("Групповой поиск нашёл не то же, что поиск по одному.");
+    }
+
+    const auto count = static_cast<double>(attempt_count);
+    std::cout << "\tПоиск по одному (нс на элемент): " << duration_cast<duration<double, std::nano>>(one_by_one_time).count() / count << std::endl;
+    std::cout << "\tГрупповой поиск (нс на элемент): " << duration_cast<duration<double, std::nano>>(batch_time).count() / count << std::endl;
+    std::cout << std::endl;
+}
+
+//!     Измерение времени построения из упорядоченного набора.
+/*!
+        Сравнивается построение в одном потоке и в thread_count потоках.
+ */
 template <typename Container>
-void test (const Container & arities, std::size_t attempts)
+void test_construction (const Container & numbers, std::size_t arity, std::size_t thread_count)
+{
+    using namespace std::chrono;
+    using value_type = typename Container::value_type;
+
+    std::cout << "k_ary_set(" << arity << ")" << std::endl;
+
+    auto serial_start = steady_clock::now();
+    burst::k_ary_search_set<value_type> serial(burst::container::unique_ordered_tag, numbers.begin(), numbers.end(), arity);
+    auto serial_time = steady_clock::now() - serial_start;
+
+    auto parallel_start = steady_clock::now();
+    burst::k_ary_search_set<value_type> parallel
+    (
+        burst::container::parallel(thread_count),
+        burst::container::unique_ordered_tag,
+        numbers.begin(), numbers.end(),
+        arity
+    );
+    auto parallel_time = steady_clock::now() - parallel_start;
+
+    if (not std::equal(serial.begin(), serial.end(), parallel.begin(), parallel.end()))
+    {
+        throw std::runtime_error("Параллельное построение дало не то же дерево, что и последовательное.");
+    }
+
+    std::cout << "\tПоследовательное построение: " << duration_cast<duration<double>>(serial_time).count() << std::endl;
+    std::cout << "\tПараллельное построение (" << thread_count << "): " << duration_cast<duration<double>>(parallel_time).count() << std::endl;
+    std::cout << std::endl;
+}
+
+//!     Измерение времени открытия образа.
+/*!
+        Сравнивается построение множества из упорядоченного набора с открытием образа того же
+    множества, отображённого в память, и первыми поисками в нём.
+ */
+template <typename Container>
+void test_image (const Container & numbers, std::size_t arity, std::size_t attempt_count)
+{
+    using namespace std::chrono;
+    using value_type = typename Container::value_type;
+
+    std::cout << "k_ary_set(" << arity << ")" << std::endl;
+
+    auto build_start = steady_clock::now();
+    burst::k_ary_search_set<value_type> set(burst::container::unique_ordered_tag, numbers.begin(), numbers.end(), arity);
+    auto build_time = steady_clock::now() - build_start;
+
+    const std::string path = "k_ary_search_set.image";
+    {
+        std::ofstream stream(path, std::ios::binary);
+        burst::container::write_image(set, stream);
+    }
+
+    auto open_start = steady_clock::now();
+    using mapped_set_type = burst::k_ary_search_set<value_type, std::less<value_type>, burst::container::mapped_nodes<>>;
+    const auto mapped = burst::container::load_image<mapped_set_type>(burst::container::k_ary_image{path});
+    auto open_time = steady_clock::now() - open_start;
+
+    std::default_random_engine engine;
+    std::uniform_int_distribution<std::size_t> uniform(0, numbers.size() - 1);
+    auto search_start = steady_clock::now();
+    for (std::size_t attempt = 0; attempt < attempt_count; ++attempt)
+    {
+        const auto & element = numbers[uniform(engine)];
+        if (mapped.find(element) == mapped.end())
+        {
+            throw std::runtime_error("В образе нашлись не все искомые элементы.");
+        }
+    }
+    auto search_time = steady_clock::now() - search_start;
+
+    std::remove(path.c_str());
+
+    std::cout << "\tПостроение: " << duration_cast<duration<double>>(build_time).count() << std::endl;
+    std::cout << "\tОткрытие образа: " << duration_cast<duration<double>>(open_time).count() << std::endl;
+    std::cout << "\tСреднее время поиска в образе (нс): " << duration_cast<duration<double, std::nano>>(search_time).count() / static_cast<double>(attempt_count) << std::endl;
+    std::cout << std::endl;
+}
+
+template <typename Container>
+void test (const Container & arities, std::size_t attempts, std::size_t generate, std::size_t threads)
 {
     using integer_type = std::int64_t;
     std::vector<integer_type> numbers;
-    read(std::cin, numbers);
+    if (generate > 0)
+    {
+        std::default_random_engine engine;
+        std::uniform_int_distribution<integer_type> uniform;
+        numbers.resize(generate);
+        std::generate(numbers.begin(), numbers.end(), [&] () { return uniform(engine); });
+    }
+    else
+    {
+        read(std::cin, numbers);
+    }
     std::sort(numbers.begin(), numbers.end());
     numbers.erase(std::unique(numbers.begin(), numbers.end()), numbers.end());
 
+    std::cout << "Размер множества: " << numbers.size() << " (" << numbers.size() * sizeof(integer_type) / (1024 * 1024) << " МиБ)" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Задержка" << std::endl << std::endl;
     for (auto arity: arities)
     {
         test_one(numbers, attempts, k_ary_constructor<integer_type>(arity));
+        test_one(numbers, attempts, k_ary_constructor<integer_type, burst::container::cache_aligned_nodes>(arity, ", aligned"));
     }
 
+    test_one(numbers, attempts, static_k_ary_constructor<integer_type, 5>());
+    test_one(numbers, attempts, static_k_ary_constructor<integer_type, 9>());
+    test_one(numbers, attempts, static_k_ary_constructor<integer_type, 17>());
+
+    using namespace burst::container;
+    test_one(numbers, attempts, static_search_constructor<integer_type, eytzinger_layout>("eytzinger"));
+    test_one(numbers, attempts, static_search_constructor<integer_type, s_tree_layout<8>>("s_tree, 8"));
+    test_one(numbers, attempts, static_search_constructor<integer_type, s_tree_layout<16>>("s_tree, 16"));
+    test_one(numbers, attempts, static_search_constructor<integer_type, k_ary_layout<9, cache_aligned_nodes>>("k_ary, 9, aligned"));
+
     test_one(numbers, attempts, default_constructor<std::set<integer_type>>("set"));
     test_one(numbers, attempts, default_constructor<boost::container::flat_set<integer_type>>("flat_set"));
     test_one(numbers, attempts, default_constructor<std::unordered_set<integer_type>>("hash_set"));
+
+    std::cout << "Пропускная способность" << std::endl << std::endl;
+    for (auto arity: arities)
+    {
+        test_throughput(numbers, attempts, k_ary_constructor<integer_type>(arity));
+        test_throughput(numbers, attempts, k_ary_constructor<integer_type, burst::container::cache_aligned_nodes>(arity, ", aligned"));
+    }
+
+    std::cout << "Построение" << std::endl << std::endl;
+    for (auto arity: arities)
+    {
+        test_construction(numbers, arity, threads);
+    }
+
+    std::cout << "Образ" << std::endl << std::endl;
+    for (auto arity: arities)
+    {
+        test_image(numbers, arity, attempts);
+    }
 }
 
 int main (int argc, const char * argv[])
@@ -102,7 +327,12 @@ int main (int argc, const char * argv[])
     description.add_options()
         ("help,h", "Подсказка")
         ("arity", bpo::value<std::vector<std::size_t>>()->multitoken(), "Набор кратностей для испытаний")
-        ("attempts", bpo::value<std::size_t>()->default_value(1000));
+        ("attempts", bpo::value<std::size_t>()->default_value(1000))
+        ("generate", bpo::value<std::size_t>()->default_value(0),
+            "Породить множество заданного размера из случайных чисел вместо чтения со стандартного "
+            "входа. Удобно для измерения на множествах, не помещающихся в кэш.")
+        ("threads", bpo::value<std::size_t>()->default_value(std::thread::hardware_concurrency()),
+            "Количество потоков для параллельного построения");
 
     try
     {
@@ -118,8 +348,10 @@ int main (int argc, const char * argv[])
         {
             std::vector<std::size_t> arities = vm["arity"].as<std::vector<std::size_t>>();
             std::size_t attempts = vm["attempts"].as<std::size_t>();
+            std::size_t generate = vm["generate"].as<std::size_t>();
+            std::size_t threads = vm["threads"].as<std::size_t>();
 
-            test(arities, attempts);
+            test(arities, attempts, generate, threads);
         }
     }
     catch (bpo::error & e)
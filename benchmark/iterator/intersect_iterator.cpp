@@ -30,6 +30,67 @@ void test_on_the_fly_intersect (const Container & values)
     std::cout << std::endl;
 }
 
+//!     Поэлементное и порционное чтение на лету в буфер.
+/*!
+        Оба способа записывают элементы в один и тот же буфер и подсчитывают сумму прочитанного,
+    так что разница во времени — это разница в накладных расходах на один элемент.
+ */
+template <typename Container>
+void test_on_the_fly_intersect_by_batches (const Container & values)
+{
+    using nested_container_type = typename Container::value_type;
+    using range_type = boost::iterator_range<typename nested_container_type::const_iterator>;
+
+    nested_container_type batch(1024);
+
+    {
+        std::vector<range_type> ranges;
+        boost::for_each(values, [& ranges] (const auto & row) { ranges.push_back(boost::make_iterator_range(row)); });
+
+        clock_t intersect_time = clock();
+        auto current = burst::make_intersect_iterator(boost::make_iterator_range(ranges));
+        auto end = burst::make_intersect_iterator(current, burst::iterator::end_tag);
+        std::int64_t sum = 0;
+        while (current != end)
+        {
+            auto batch_end = batch.begin();
+            for (/* пусто */; batch_end != batch.end() && current != end; ++batch_end, ++current)
+            {
+                *batch_end = *current;
+            }
+            sum = std::accumulate(batch.begin(), batch_end, sum);
+        }
+        intersect_time = clock() - intersect_time;
+
+        std::cout << "Пересечение на лету поэлементно в буфер: " << sum << std::endl;
+        std::cout << "\t" << static_cast<double>(intersect_time) / CLOCKS_PER_SEC << std::endl;
+        std::cout << std::endl;
+    }
+
+    {
+        std::vector<range_type> ranges;
+        boost::for_each(values, [& ranges] (const auto & row) { ranges.push_back(boost::make_iterator_range(row)); });
+
+        clock_t intersect_time = clock();
+        auto current = burst::make_intersect_iterator(boost::make_iterator_range(ranges));
+        std::int64_t sum = 0;
+        for
+        (
+            auto batch_end = current.next_batch(batch.begin(), batch.end());
+            batch_end != batch.begin();
+            batch_end = current.next_batch(batch.begin(), batch.end())
+        )
+        {
+            sum = std::accumulate(batch.begin(), batch_end, sum);
+        }
+        intersect_time = clock() - intersect_time;
+
+        std::cout << "Пересечение на лету порциями по " << batch.size() << ": " << sum << std::endl;
+        std::cout << "\t" << static_cast<double>(intersect_time) / CLOCKS_PER_SEC << std::endl;
+        std::cout << std::endl;
+    }
+}
+
 template <typename Container>
 void test_std_intersect (const Container & values)
 {
@@ -57,4 +118,5 @@ int main ()
 
     test_std_intersect(values);
     test_on_the_fly_intersect(values);
+    test_on_the_fly_intersect_by_batches(values);
 }
@@ -42,6 +42,67 @@ void test_on_the_fly_merge (const Container & values)
     std::cout << std::endl;
 }
 
+//!     Поэлементное и порционное чтение на лету в буфер.
+/*!
+        Оба способа записывают элементы в один и тот же буфер и подсчитывают сумму прочитанного,
+    так что разница во времени — это разница в накладных расходах на один элемент.
+ */
+template <typename Container>
+void test_on_the_fly_merge_by_batches (const Container & values)
+{
+    using nested_container_type = typename Container::value_type;
+    using range_type = boost::iterator_range<typename nested_container_type::const_iterator>;
+
+    nested_container_type batch(1024);
+
+    {
+        std::vector<range_type> ranges;
+        boost::for_each(values, [& ranges] (const auto & row) { ranges.push_back(boost::make_iterator_range(row)); });
+
+        clock_t merge_time = clock();
+        auto current = burst::make_merge_iterator(boost::make_iterator_range(ranges));
+        auto end = burst::make_merge_iterator(current, burst::iterator::end_tag);
+        std::int64_t sum = 0;
+        while (current != end)
+        {
+            auto batch_end = batch.begin();
+            for (/* пусто */; batch_end != batch.end() && current != end; ++batch_end, ++current)
+            {
+                *batch_end = *current;
+            }
+            sum = std::accumulate(batch.begin(), batch_end, sum);
+        }
+        merge_time = clock() - merge_time;
+
+        std::cout << "Слияние на лету поэлементно в буфер: " << sum << std::endl;
+        std::cout << "\t" << static_cast<double>(merge_time) / CLOCKS_PER_SEC << std::endl;
+        std::cout << std::endl;
+    }
+
+    {
+        std::vector<range_type> ranges;
+        boost::for_each(values, [& ranges] (const auto & row) { ranges.push_back(boost::make_iterator_range(row)); });
+
+        clock_t merge_time = clock();
+        auto current = burst::make_merge_iterator(boost::make_iterator_range(ranges));
+        std::int64_t sum = 0;
+        for
+        (
+            auto batch_end = current.next_batch(batch.begin(), batch.end());
+            batch_end != batch.begin();
+            batch_end = current.next_batch(batch.begin(), batch.end())
+        )
+        {
+            sum = std::accumulate(batch.begin(), batch_end, sum);
+        }
+        merge_time = clock() - merge_time;
+
+        std::cout << "Слияние на лету порциями по " << batch.size() << ": " << sum << std::endl;
+        std::cout << "\t" << static_cast<double>(merge_time) / CLOCKS_PER_SEC << std::endl;
+        std::cout << std::endl;
+    }
+}
+
 template <typename Container>
 void test_merge_by_sorting (const Container & values)
 {
@@ -90,4 +151,5 @@ int main ()
     test_merge_by_sorting(values);
     test_std_merge(values);
     test_on_the_fly_merge(values);
+    test_on_the_fly_merge_by_batches(values);
 }
@@ -0,0 +1,167 @@
+#include <burst/range/difference.hpp>
+#include <burst/range/multidifference.hpp>
+#include <burst/range/unite.hpp>
+#include <io.hpp>
+
+#include <boost/range/algorithm/for_each.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+template <typename Container>
+auto make_subtrahend_ranges (const Container & values)
+{
+    using nested_container_type = typename Container::value_type;
+
+    std::vector<boost::iterator_range<typename nested_container_type::const_iterator>> ranges;
+    boost::for_each(boost::make_iterator_range(std::next(values.begin()), values.end()),
+        [& ranges] (const nested_container_type & values)
+        {
+            ranges.push_back(boost::make_iterator_range(values));
+        });
+
+    return ranges;
+}
+
+template <typename Container>
+void test_on_the_fly_multidifference (const Container & values)
+{
+    auto subtrahends = make_subtrahend_ranges(values);
+
+    clock_t difference_time = clock();
+    auto difference =
+        burst::multidifference
+        (
+            boost::make_iterator_range(values.front()),
+            boost::make_iterator_range(subtrahends)
+        );
+    auto distance = static_cast<std::size_t>(std::distance(difference.begin(), difference.end()));
+    difference_time = clock() - difference_time;
+
+    std::cout << "Разность с несколькими вычитаемыми на лету: " << distance << std::endl;
+    std::cout << "\t" << static_cast<double>(difference_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
+template <typename Range, typename Subtrahends>
+auto nest_difference (Range minuend, const Subtrahends &, std::integral_constant<std::size_t, 0>)
+{
+    return minuend;
+}
+
+//!     Вложенная разность "на лету": difference(difference(...(minuend, s[0])...), s[Depth - 1]).
+/*!
+        Глубина вложенности известна на этапе компиляции, так что каждый уровень — это отдельный
+    итератор разности поверх итератора предыдущего уровня.
+ */
+template <typename Range, typename Subtrahends, std::size_t Depth>
+auto nest_difference (Range minuend, const Subtrahends & subtrahends, std::integral_constant<std::size_t, Depth>)
+{
+    return
+        nest_difference
+        (
+            burst::difference(std::move(minuend), subtrahends[subtrahends.size() - Depth]),
+            subtrahends,
+            std::integral_constant<std::size_t, Depth - 1>{}
+        );
+}
+
+template <std::size_t Depth, typename Container>
+void test_nested_difference (const Container & values)
+{
+    auto subtrahends = make_subtrahend_ranges(values);
+    if (subtrahends.size() < Depth)
+    {
+        return;
+    }
+    subtrahends.resize(Depth);
+
+    clock_t nested_time = clock();
+    auto nested =
+        nest_difference
+        (
+            boost::make_iterator_range(values.front()),
+            subtrahends,
+            std::integral_constant<std::size_t, Depth>{}
+        );
+    auto nested_distance = static_cast<std::size_t>(std::distance(nested.begin(), nested.end()));
+    nested_time = clock() - nested_time;
+
+    clock_t multidifference_time = clock();
+    auto difference =
+        burst::multidifference
+        (
+            boost::make_iterator_range(values.front()),
+            boost::make_iterator_range(subtrahends)
+        );
+    auto distance = static_cast<std::size_t>(std::distance(difference.begin(), difference.end()));
+    multidifference_time = clock() - multidifference_time;
+
+    std::cout << "Вложенная разность на лету, " << Depth << " вычитаемых: " << nested_distance << std::endl;
+    std::cout << "\t" << static_cast<double>(nested_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << "Разность с " << Depth << " вычитаемыми на лету: " << distance << std::endl;
+    std::cout << "\t" << static_cast<double>(multidifference_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
+template <typename Container>
+void test_difference_of_materialized_union (const Container & values)
+{
+    auto subtrahends = make_subtrahend_ranges(values);
+
+    clock_t difference_time = clock();
+    auto united = burst::unite(boost::make_iterator_range(subtrahends));
+    typename Container::value_type subtrahend(united.begin(), united.end());
+
+    auto difference =
+        burst::difference
+        (
+            boost::make_iterator_range(values.front()),
+            boost::make_iterator_range(subtrahend)
+        );
+    auto distance = static_cast<std::size_t>(std::distance(difference.begin(), difference.end()));
+    difference_time = clock() - difference_time;
+
+    std::cout << "Разность с готовым объединением: " << distance << std::endl;
+    std::cout << "\t" << static_cast<double>(difference_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
+template <typename Container>
+void test_nested_std_difference (const Container & values)
+{
+    typename Container::value_type difference(values.front());
+
+    clock_t difference_time = clock();
+    for (const auto & row: boost::make_iterator_range(std::next(values.begin()), values.end()))
+    {
+        typename Container::value_type result;
+        result.reserve(difference.size());
+        std::set_difference(difference.begin(), difference.end(), row.begin(), row.end(), std::back_inserter(result));
+        std::swap(result, difference);
+    }
+    difference_time = clock() - difference_time;
+
+    std::cout << "Последовательный std::set_difference: " << difference.size() << std::endl;
+    std::cout << "\t" << static_cast<double>(difference_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
+int main ()
+{
+    std::vector<std::vector<std::int64_t>> values;
+    read_many(std::cin, values);
+
+    if (not values.empty())
+    {
+        test_nested_std_difference(values);
+        test_difference_of_materialized_union(values);
+        test_on_the_fly_multidifference(values);
+        test_nested_difference<4>(values);
+        test_nested_difference<8>(values);
+    }
+}
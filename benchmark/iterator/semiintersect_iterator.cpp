@@ -0,0 +1,115 @@
+#include <burst/range/merge.hpp>
+#include <burst/range/semiintersect.hpp>
+#include <io.hpp>
+
+#include <boost/program_options.hpp>
+#include <boost/range/algorithm/for_each.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+template <typename Container>
+auto make_ranges (const Container & values)
+{
+    using nested_container_type = typename Container::value_type;
+
+    std::vector<boost::iterator_range<typename nested_container_type::const_iterator>> ranges;
+    boost::for_each(values,
+        [& ranges] (const nested_container_type & values)
+        {
+            ranges.push_back(boost::make_iterator_range(values));
+        });
+
+    return ranges;
+}
+
+template <typename Container>
+void test_on_the_fly_semiintersect (const Container & values, std::size_t min_items)
+{
+    auto ranges = make_ranges(values);
+
+    clock_t semiintersect_time = clock();
+    auto semiintersection = burst::semiintersect(boost::make_iterator_range(ranges), min_items);
+    auto distance = static_cast<std::size_t>(std::distance(semiintersection.begin(), semiintersection.end()));
+    semiintersect_time = clock() - semiintersect_time;
+
+    std::cout << "Полупересечение на лету: " << distance << std::endl;
+    std::cout << "\t" << static_cast<double>(semiintersect_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
+//!     Полупересечение через слияние и подсчёт повторов.
+/*!
+        Каждый диапазон рассматривается как множество, поэтому результат совпадает с
+    полупересечением только тогда, когда во входных диапазонах нет повторов.
+ */
+template <typename Container>
+void test_merge_and_count (const Container & values, std::size_t min_items)
+{
+    auto ranges = make_ranges(values);
+
+    clock_t semiintersect_time = clock();
+    auto merged = burst::merge(boost::make_iterator_range(ranges));
+
+    std::size_t distance = 0;
+    auto current = merged.begin();
+    while (current != merged.end())
+    {
+        auto value = *current;
+        std::size_t count = 0;
+        while (current != merged.end() && *current == value)
+        {
+            ++count;
+            ++current;
+        }
+
+        if (count >= min_items)
+        {
+            ++distance;
+        }
+    }
+    semiintersect_time = clock() - semiintersect_time;
+
+    std::cout << "Слияние и подсчёт: " << distance << std::endl;
+    std::cout << "\t" << static_cast<double>(semiintersect_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("min-items", bpo::value<std::size_t>()->default_value(2), "Минимальное количество диапазонов, в которых должен быть элемент");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            std::vector<std::vector<std::int64_t>> values;
+            read_many(std::cin, values);
+
+            std::size_t min_items = vm["min-items"].as<std::size_t>();
+
+            test_merge_and_count(values, min_items);
+            test_on_the_fly_semiintersect(values, min_items);
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
@@ -0,0 +1,146 @@
+#ifndef BURST_ALGORITHM_DETAIL_INTEGRAL_GALLOPING_HPP
+#define BURST_ALGORITHM_DETAIL_INTEGRAL_GALLOPING_HPP
+
+#include <burst/container/detail/count_less.hpp>
+#include <burst/container/detail/prefetch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Проверка того, что скачущий поиск можно вести по целым числам, лежащим в памяти подряд.
+        /*!
+                Это так, если итератор — указатель или итератор std::vector, элементы — целые числа
+            того же типа, что и искомое значение, а порядок — естественный.
+         */
+        template <typename Iterator, typename Value, typename Compare>
+        struct is_integral_galloping_applicable
+        {
+            using element_type = std::remove_cv_t<typename std::iterator_traits<Iterator>::value_type>;
+
+            static const bool value =
+                std::is_integral<element_type>::value &&
+                not std::is_same<element_type, bool>::value &&
+                std::is_same<element_type, Value>::value &&
+                (
+                    std::is_pointer<Iterator>::value ||
+                    std::is_same<Iterator, typename std::vector<element_type>::iterator>::value ||
+                    std::is_same<Iterator, typename std::vector<element_type>::const_iterator>::value
+                ) &&
+                (
+                    std::is_same<Compare, std::less<Value>>::value ||
+                    std::is_same<Compare, std::less<>>::value
+                );
+        };
+
+        //!     Подсчёт элементов, меньших заданного значения, в отрезке произвольной длины.
+        /*!
+                Отрезок обрабатывается кусками по восемь элементов с помощью векторного подсчёта,
+            а остаток — простым циклом без ветвлений.
+         */
+        template <typename Integer>
+        std::size_t count_less (const Integer * first, std::size_t size, Integer value)
+        {
+            const std::size_t chunk = 8;
+
+            const auto whole_chunks = size / chunk;
+
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < whole_chunks; ++i)
+            {
+                count += count_less<chunk>(first + i * chunk, value);
+            }
+            for (auto i = whole_chunks * chunk; i < size; ++i)
+            {
+                count += static_cast<std::size_t>(first[i] < value);
+            }
+            return count;
+        }
+
+        //!     Скачущий поиск нижней грани в массиве целых чисел.
+        /*!
+                Скачки — те же, что и в общем алгоритме: короткие ветвящиеся шаги почти не
+            занимают процессор, поэтому при случайном начале поиска в большом массиве он успевает
+            начать загрузку следующих данных, пока ждёт текущие.
+                Отличается от общего алгоритма только доиском: двоичный поиск в окне, где оказался
+            ответ, останавливается, как только окно сужается до 64 байт, и ответ дочитывается
+            подсчётом меньших элементов без ветвлений вместо последних, плохо предсказуемых, шагов
+            двоичного поиска.
+                Двоичный поиск в большом окне остаётся с ветвлениями: на массивах, не помещающихся
+            в кэш, предсказание переходов позволяет процессору заранее начать загрузку следующего
+            элемента, и поиск без ветвлений оказывается медленнее.
+         */
+        template <typename Integer>
+        const Integer * integral_galloping_lower_bound_impl (const Integer * first, const Integer * last, Integer value)
+        {
+            const std::size_t line_elements = prefetch_line_size / sizeof(Integer);
+
+            const auto size = static_cast<std::size_t>(last - first);
+
+            // Элементы [0, low) меньше искомого, а ответ лежит в [low, high].
+            std::size_t low = 0;
+            std::size_t high = size;
+            for (std::size_t step = 1; low + step < size; step *= 2)
+            {
+                const auto probe = low + step;
+                if (first[probe] < value)
+                {
+                    low = probe + 1;
+                }
+                else
+                {
+                    high = probe;
+                    break;
+                }
+            }
+
+            auto base = first + low;
+            auto window = high - low;
+            while (window > line_elements)
+            {
+                const auto half = window / 2;
+                if (base[half] < value)
+                {
+                    base += half + 1;
+                    window -= half + 1;
+                }
+                else
+                {
+                    window = half;
+                }
+            }
+
+            return base + count_less(base, window, value);
+        }
+
+        //!     Нижняя грань в диапазоне целых чисел, лежащих в памяти подряд.
+        template <typename RandomAccessIterator, typename Integer>
+        RandomAccessIterator
+            integral_galloping_lower_bound
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                Integer value
+            )
+        {
+            if (first == last)
+            {
+                return last;
+            }
+
+            const Integer * data = std::addressof(*first);
+            const auto found = integral_galloping_lower_bound_impl(data, data + (last - first), value);
+            return first + (found - data);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ALGORITHM_DETAIL_INTEGRAL_GALLOPING_HPP
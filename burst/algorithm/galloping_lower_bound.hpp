@@ -1,14 +1,73 @@
 #ifndef BURST_ALGORITHM_GALLOPING_LOWER_BOUND_HPP
 #define BURST_ALGORITHM_GALLOPING_LOWER_BOUND_HPP
 
+#include <burst/algorithm/detail/integral_galloping.hpp>
+
 #include <boost/assert.hpp>
 
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <type_traits>
 
 namespace burst
 {
+    namespace detail
+    {
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            galloping_lower_bound_impl
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                const Value & value,
+                Compare compare,
+                std::false_type
+            )
+        {
+            BOOST_ASSERT(std::is_sorted(first, last, compare));
+
+            const auto distance = std::distance(first, last);
+
+            auto position = static_cast<decltype(distance)>(0);
+            auto step = static_cast<decltype(distance)>(1);
+
+            while (position + step < distance)
+            {
+                const auto current = std::next(first, step);
+                if (compare(*current, value))
+                {
+                    first = std::next(current);
+                    position += step + 1;
+                    step *= 2;
+                }
+                else
+                {
+                    return std::lower_bound(first, current, value, compare);
+                }
+            }
+
+            return std::lower_bound(first, last, value, compare);
+        }
+
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            galloping_lower_bound_impl
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                const Value & value,
+                Compare compare,
+                std::true_type
+            )
+        {
+            BOOST_ASSERT(std::is_sorted(first, last, compare));
+            static_cast<void>(compare);
+
+            return integral_galloping_lower_bound(first, last, value);
+        }
+    } // namespace detail
+
     //!     "Скачущий" поиск нижней грани.
     /*!
             Эффективен для поиска значения в упорядоченном диапазоне, если известно, что искомый
@@ -44,6 +103,11 @@ namespace burst
            б. Если бегунок выскочил за пределы диапазона или элемент не меньше искомого, то искомый
               элемент доискивается двоичным поиском между предыдущим и текущим положением бегунка.
 
+            Если элементы диапазона — целые числа, лежащие в памяти подряд (указатели или
+        итераторы std::vector), искомое значение того же типа, а порядок естественный, то
+        используется ускоренный вариант: последние шаги двоичного поиска заменяются подсчётом
+        без ветвлений в окне размером в строку кэша, а скачки остаются такими же.
+
             Асимптотика.
 
         Время: O(logN), N = |[first, last)| — размер диапазона.
@@ -52,29 +116,8 @@ namespace burst
     template <typename RandomAccessIterator, typename Value, typename Compare>
     RandomAccessIterator galloping_lower_bound (RandomAccessIterator first, RandomAccessIterator last, const Value & value, Compare compare)
     {
-        BOOST_ASSERT(std::is_sorted(first, last, compare));
-
-        const auto distance = std::distance(first, last);
-
-        auto position = static_cast<decltype(distance)>(0);
-        auto step = static_cast<decltype(distance)>(1);
-
-        while (position + step < distance)
-        {
-            const auto current = std::next(first, step);
-            if (compare(*current, value))
-            {
-                first = std::next(current);
-                position += step + 1;
-                step *= 2;
-            }
-            else
-            {
-                return std::lower_bound(first, current, value, compare);
-            }
-        }
-
-        return std::lower_bound(first, last, value, compare);
+        using is_integral = detail::is_integral_galloping_applicable<RandomAccessIterator, Value, Compare>;
+        return detail::galloping_lower_bound_impl(first, last, value, compare, std::integral_constant<bool, is_integral::value>{});
     }
 
     template <typename RandomAccessIterator, typename Value>
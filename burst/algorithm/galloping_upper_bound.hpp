@@ -1,14 +1,79 @@
 #ifndef BURST_ALGORITHM_GALLOPING_UPPER_BOUND_HPP
 #define BURST_ALGORITHM_GALLOPING_UPPER_BOUND_HPP
 
+#include <burst/algorithm/detail/integral_galloping.hpp>
+
 #include <boost/assert.hpp>
 
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <limits>
+#include <type_traits>
 
 namespace burst
 {
+    namespace detail
+    {
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            galloping_upper_bound_impl
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                const Value & value,
+                Compare compare,
+                std::false_type
+            )
+        {
+            BOOST_ASSERT(std::is_sorted(first, last, compare));
+
+            const auto distance = std::distance(first, last);
+
+            auto position = static_cast<decltype(distance)>(0);
+            auto step = static_cast<decltype(distance)>(1);
+
+            while (position + step < distance)
+            {
+                const auto current = std::next(first, step);
+                if (not compare(value, *current))
+                {
+                    first = std::next(current);
+                    position += step + 1;
+                    step *= 2;
+                }
+                else
+                {
+                    return std::upper_bound(first, current, value, compare);
+                }
+            }
+
+            return std::upper_bound(first, last, value, compare);
+        }
+
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            galloping_upper_bound_impl
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                const Value & value,
+                Compare compare,
+                std::true_type
+            )
+        {
+            BOOST_ASSERT(std::is_sorted(first, last, compare));
+            static_cast<void>(compare);
+
+            // Для целых чисел "не больше v" — то же самое, что "меньше v + 1".
+            if (value == std::numeric_limits<Value>::max())
+            {
+                return last;
+            }
+            return integral_galloping_lower_bound(first, last, static_cast<Value>(value + 1));
+        }
+    } // namespace detail
+
     //!     "Скачущий" поиск верхней грани.
     /*!
             Эффективен для поиска значения в упорядоченном диапазоне, если известно, что искомый
@@ -44,6 +109,11 @@ namespace burst
            б. Если бегунок выскочил за пределы диапазона или элемент больше искомого, то искомый
               элемент доискивается двоичным поиском между предыдущим и текущим положением бегунка.
 
+            Если элементы диапазона — целые числа, лежащие в памяти подряд (указатели или
+        итераторы std::vector), искомое значение того же типа, а порядок естественный, то
+        используется ускоренный вариант: последние шаги двоичного поиска заменяются подсчётом
+        без ветвлений в окне размером в строку кэша, а скачки остаются такими же.
+
             Асимптотика.
 
         Время: O(logN), N = |[first, last)| — размер диапазона.
@@ -52,29 +122,8 @@ namespace burst
     template <typename RandomAccessIterator, typename Value, typename Compare>
     RandomAccessIterator galloping_upper_bound (RandomAccessIterator first, RandomAccessIterator last, const Value & value, Compare compare)
     {
-        BOOST_ASSERT(std::is_sorted(first, last, compare));
-
-        const auto distance = std::distance(first, last);
-
-        auto position = static_cast<decltype(distance)>(0);
-        auto step = static_cast<decltype(distance)>(1);
-
-        while (position + step < distance)
-        {
-            const auto current = std::next(first, step);
-            if (not compare(value, *current))
-            {
-                first = std::next(current);
-                position += step + 1;
-                step *= 2;
-            }
-            else
-            {
-                return std::upper_bound(first, current, value, compare);
-            }
-        }
-
-        return std::upper_bound(first, last, value, compare);
+        using is_integral = detail::is_integral_galloping_applicable<RandomAccessIterator, Value, Compare>;
+        return detail::galloping_upper_bound_impl(first, last, value, compare, std::integral_constant<bool, is_integral::value>{});
     }
 
     template <typename RandomAccessIterator, typename Value>
@@ -0,0 +1,380 @@
+#ifndef BURST_ALGORITHM_SEARCHING_APPROXIMATE_BITAP_HPP
+#define BURST_ALGORITHM_SEARCHING_APPROXIMATE_BITAP_HPP
+
+#include <burst/algorithm/searching/detail/bitmask_operations.hpp>
+#include <burst/algorithm/searching/detail/bitmask_traits.hpp>
+#include <burst/algorithm/searching/detail/default_bitmask_map.hpp>
+#include <burst/algorithm/searching/detail/element_position_bitmask_table.hpp>
+#include <burst/algorithm/searching/detail/pattern_element_traits.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    namespace algorithm
+    {
+        //!     Расстояние Хэмминга.
+        /*!
+                Политика приближённого поиска, допускающая только замены элементов: совпадение
+            всегда имеет ту же длину, что и образец, а количество ошибок — это количество мест, на
+            которых элементы совпадения отличаются от элементов образца.
+         */
+        struct hamming_distance
+        {
+            //!     Начальное состояние столбца, допускающего заданное количество ошибок.
+            template <typename Bitmask>
+            static Bitmask initial_column (std::size_t /* errors */)
+            {
+                return Bitmask{0};
+            }
+
+            //!     Переход к следующему элементу текста.
+            /*!
+                    Принимает столбец с тем же количеством ошибок до и после прочтения элемента,
+                столбец с количеством ошибок на единицу меньше до и после прочтения элемента, а также
+                позиционную маску прочитанного элемента.
+                    Префикс образца совпадает с не более чем d ошибками, если более короткий префикс
+                совпадал с не более чем d ошибками и очередной элемент совпал, или если более
+                короткий префикс совпадал с не более чем d - 1 ошибками, а очередной элемент
+                заменён.
+             */
+            template <typename Bitmask>
+            static Bitmask
+                next_column
+                (
+                    Bitmask column,
+                    Bitmask lower_column,
+                    Bitmask /* next_lower_column */,
+                    Bitmask element_mask
+                )
+            {
+                return (shift(column) & element_mask) | shift(lower_column);
+            }
+
+            template <typename Bitmask>
+            static Bitmask shift (const Bitmask & bitmask)
+            {
+                return detail::bit_shift<Bitmask>{}(bitmask);
+            }
+        };
+
+        //!     Расстояние Левенштейна.
+        /*!
+                Политика приближённого поиска, допускающая замены, вставки и удаления элементов.
+            Количество ошибок — это наименьшее количество таких правок, превращающих совпадение в
+            образец.
+         */
+        struct levenshtein_distance
+        {
+            //!     Начальное состояние столбца, допускающего заданное количество ошибок.
+            /*!
+                    До начала текста первые d элементов образца совпадают с пустой строкой ценой
+                их удаления.
+             */
+            template <typename Bitmask>
+            static Bitmask initial_column (std::size_t errors)
+            {
+                auto column = Bitmask{0};
+                for (std::size_t i = 0; i < errors; ++i)
+                {
+                    column = shift(column);
+                }
+                return column;
+            }
+
+            //!     Переход к следующему элементу текста.
+            /*!
+                    К переходам расстояния Хэмминга добавляются ещё два:
+                    1. Вставка — лишний элемент текста: префикс, совпадавший с d - 1 ошибками до
+                       прочтения элемента, совпадает с d ошибками после.
+                    2. Удаление — пропущенный элемент образца: если префикс совпадает с d - 1
+                       ошибками после прочтения элемента, то префикс, который длиннее на единицу,
+                       совпадает с d ошибками.
+             */
+            template <typename Bitmask>
+            static Bitmask
+                next_column
+                (
+                    Bitmask column,
+                    Bitmask lower_column,
+                    Bitmask next_lower_column,
+                    Bitmask element_mask
+                )
+            {
+                return
+                    (shift(column) & element_mask) |
+                    shift(lower_column) |
+                    lower_column |
+                    shift(next_lower_column);
+            }
+
+            template <typename Bitmask>
+            static Bitmask shift (const Bitmask & bitmask)
+            {
+                return detail::bit_shift<Bitmask>{}(bitmask);
+            }
+        };
+
+        //!     Приближённое вхождение образца в текст.
+        /*!
+                Содержит количество ошибок, с которым образец входит в текст, и диапазон, конец
+            которого совпадает с концом вхождения, а длина равна длине образца (или меньше, если от
+            начала текста до конца вхождения меньше элементов, чем в образце).
+                Для расстояния Хэмминга диапазон и есть вхождение. Для расстояния Левенштейна
+            вхождение может быть длиннее или короче образца не более чем на допустимое количество
+            ошибок, и точно известен только его конец.
+         */
+        template <typename ForwardIterator>
+        struct approximate_match
+        {
+            boost::iterator_range<ForwardIterator> range;
+            std::size_t errors;
+        };
+
+        //!     Приближённый двоичный алгоритм поиска подстроки (алгоритм Ву — Манбера).
+        /*!
+                Ищет в тексте все места, где кончаются вхождения образца с не более чем k ошибками.
+            Вместо одного столбца битов, как в точном алгоритме, хранит k + 1 столбец: в d-м столбце
+            j-й бит равен единице, если первые j + 1 элементов образца совпадают с концом
+            прочитанного текста с не более чем d ошибками. При прочтении очередного элемента текста
+            каждый столбец пересчитывается по своему старому значению и по старому и новому
+            значениям предыдущего столбца.
+                Для каждого места текста сообщается наименьшее количество ошибок, с которым там
+            кончается вхождение.
+
+                Асимптотика.
+
+            Время: O(k) на каждый элемент текста.
+            Память: O(k) на состояние поиска.
+
+            \tparam Value
+                Тип элементов образца и текста.
+            \tparam Bitmask
+                Тип битовой маски (см. bitap).
+            \tparam Distance
+                Мера ошибок: hamming_distance или levenshtein_distance.
+            \tparam Map
+                Ассоциативный контейнер, хранящий отображение элементов образца в битовые маски.
+         */
+        template
+        <
+            typename Value,
+            typename Bitmask,
+            typename Distance = levenshtein_distance,
+            typename Map = detail::default_bitmask_map_t<Value, Bitmask>
+        >
+        class approximate_bitap
+        {
+        public:
+            using value_type = Value;
+            using bitmask_type = Bitmask;
+            using distance_type = Distance;
+            using map_type = Map;
+            using bitmask_table_type = detail::element_position_bitmask_table<map_type>;
+
+            //!     Состояние поиска.
+            /*!
+                    Столбцы битов для каждого допустимого количества ошибок и длина диапазона
+                последнего вхождения.
+             */
+            struct state_type
+            {
+                std::vector<bitmask_type> columns;
+                std::size_t window;
+            };
+
+        public:
+            template <typename InputIterator>
+            approximate_bitap (InputIterator pattern_begin, InputIterator pattern_end, std::size_t errors):
+                m_bitmask_table(std::make_shared<const bitmask_table_type>(pattern_begin, pattern_end)),
+                m_errors(errors)
+            {
+                BOOST_ASSERT(m_bitmask_table->length() <= bitmask_size);
+                BOOST_ASSERT(m_errors < m_bitmask_table->length());
+            }
+
+            template <typename ForwardRange>
+            approximate_bitap (const ForwardRange & pattern, std::size_t errors):
+                approximate_bitap(pattern.begin(), pattern.end(), errors)
+            {
+            }
+
+        public:
+            //!     Поиск первого приближённого вхождения образца в текст.
+            /*!
+                    Возвращает первое вхождение образца с не более чем k ошибками в текст, заданный
+                полуинтервалом [corpus_begin, corpus_end). Если вхождений нет, то диапазон
+                вхождения пуст и указывает на конец текста.
+             */
+            template <typename ForwardIterator>
+            approximate_match<ForwardIterator> operator () (ForwardIterator corpus_begin, ForwardIterator corpus_end) const
+            {
+                using iterated_type = typename std::iterator_traits<ForwardIterator>::value_type;
+                static_assert(std::is_same<iterated_type, value_type>::value, "Тип элементов обыскиваемой последовательности должен совпадать с типом элементов образца.");
+
+                auto state = initial_state();
+                return find_first(corpus_begin, corpus_end, state);
+            }
+
+            //!     Найти первое приближённое вхождение образца в текст.
+            /*!
+                    Принимает диапазон, в котором нужно произвести поиск, а также ссылку на
+                состояние, которое в дальнейшем можно использовать для продолжения поиска с конца
+                найденного вхождения.
+             */
+            template <typename ForwardIterator>
+            approximate_match<ForwardIterator>
+                find_first
+                (
+                    ForwardIterator corpus_begin,
+                    ForwardIterator corpus_end,
+                    state_type & state
+                ) const
+            {
+                state = initial_state();
+                return search(corpus_begin, corpus_begin, corpus_end, state);
+            }
+
+            //!     Найти следующее приближённое вхождение образца в текст.
+            /*!
+                    Принимает предыдущее вхождение, конец текста и состояние, сохранённое
+                предыдущим поиском, и продолжает поиск с конца предыдущего вхождения.
+             */
+            template <typename ForwardIterator>
+            approximate_match<ForwardIterator>
+                find_next
+                (
+                    const approximate_match<ForwardIterator> & previous_match,
+                    ForwardIterator corpus_end,
+                    state_type & state
+                ) const
+            {
+                return search(previous_match.range.begin(), previous_match.range.end(), corpus_end, state);
+            }
+
+            //!     Начальное состояние поиска.
+            state_type initial_state () const
+            {
+                state_type state{std::vector<bitmask_type>(m_errors + 1), 0};
+                for (std::size_t d = 0; d <= m_errors; ++d)
+                {
+                    state.columns[d] = distance_type::template initial_column<bitmask_type>(d);
+                }
+                return state;
+            }
+
+            //!     Прочитать очередной элемент текста.
+            /*!
+                    Пересчитывает столбцы состояния и возвращает наименьшее количество ошибок, с
+                которым вхождение образца кончается на прочитанном элементе, или число, большее
+                допустимого количества ошибок, если такого вхождения нет.
+             */
+            std::size_t step (state_type & state, const value_type & element) const
+            {
+                const bitmask_type element_mask = (*m_bitmask_table)[element];
+
+                auto lower_column = state.columns[0];
+                state.columns[0] = distance_type::shift(lower_column) & element_mask;
+                for (std::size_t d = 1; d <= m_errors; ++d)
+                {
+                    const auto column = state.columns[d];
+                    state.columns[d] =
+                        distance_type::next_column(column, lower_column, state.columns[d - 1], element_mask);
+                    lower_column = column;
+                }
+
+                const auto match_indicator = m_bitmask_table->length() - 1;
+                const detail::test_bit<bitmask_type> is_match{};
+                std::size_t errors = 0;
+                while (errors <= m_errors && not is_match(state.columns[errors], match_indicator))
+                {
+                    ++errors;
+                }
+                return errors;
+            }
+
+            //!     Допустимое количество ошибок.
+            std::size_t errors () const
+            {
+                return m_errors;
+            }
+
+        private:
+            //!     Поиск вхождения, начиная с заданного места текста.
+            /*!
+                    Кандидат на начало вхождения отстаёт от текущего места поиска на длину образца,
+                а в начале текста — на количество прочитанных элементов, которое хранится в
+                состоянии поиска.
+             */
+            template <typename ForwardIterator>
+            approximate_match<ForwardIterator>
+                search
+                (
+                    ForwardIterator match_candidate,
+                    ForwardIterator corpus_current,
+                    ForwardIterator corpus_end,
+                    state_type & state
+                ) const
+            {
+                while (corpus_current != corpus_end)
+                {
+                    const auto errors = step(state, *corpus_current);
+                    ++corpus_current;
+                    if (state.window < m_bitmask_table->length())
+                    {
+                        ++state.window;
+                    }
+                    else
+                    {
+                        ++match_candidate;
+                    }
+
+                    if (errors <= m_errors)
+                    {
+                        return {boost::make_iterator_range(match_candidate, corpus_current), errors};
+                    }
+                }
+
+                return {boost::make_iterator_range(corpus_end, corpus_end), 0};
+            }
+
+        public:
+            static const std::size_t bitmask_size = detail::bitmask_traits<bitmask_type>::size;
+
+        private:
+            std::shared_ptr<const bitmask_table_type> m_bitmask_table;
+            std::size_t m_errors;
+        };
+
+        //!     Функция создания приближённого поискового объекта.
+        /*!
+                Принимает явно заданный тип битовой маски, образец и допустимое количество ошибок.
+            Ошибки считаются по Левенштейну.
+         */
+        template <typename Bitmask, typename ForwardRange>
+        auto make_approximate_bitap (const ForwardRange & pattern, std::size_t errors)
+        {
+            return approximate_bitap<detail::pattern_value_t<typename ForwardRange::value_type>, Bitmask>(pattern, errors);
+        }
+
+        //!     Функция создания приближённого поискового объекта с заданной мерой ошибок.
+        /*!
+                Отличается тем, что принимает явно заданный аргумент шаблона "Distance" —
+            hamming_distance или levenshtein_distance.
+         */
+        template <typename Bitmask, typename Distance, typename ForwardRange>
+        auto make_approximate_bitap (const ForwardRange & pattern, std::size_t errors)
+        {
+            return approximate_bitap<detail::pattern_value_t<typename ForwardRange::value_type>, Bitmask, Distance>(pattern, errors);
+        }
+    } // namespace algorithm
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEARCHING_APPROXIMATE_BITAP_HPP
@@ -1,17 +1,16 @@
 #ifndef BURST_ALGORITHM_SEARCHING_BITAP_HPP
 #define BURST_ALGORITHM_SEARCHING_BITAP_HPP
 
+#include <burst/algorithm/searching/detail/bitmask_operations.hpp>
 #include <burst/algorithm/searching/detail/bitmask_traits.hpp>
+#include <burst/algorithm/searching/detail/default_bitmask_map.hpp>
 #include <burst/algorithm/searching/detail/element_position_bitmask_table.hpp>
-#include <burst/integer/left_shift.hpp>
+#include <burst/algorithm/searching/detail/pattern_element_traits.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/range/iterator_range.hpp>
 
-#include <array>
-#include <climits>
 #include <iterator>
-#include <map>
 #include <memory>
 #include <type_traits>
 
@@ -29,19 +28,15 @@ namespace burst
                 специализация типа bitmask_traits<T> для выяснения размера битовой маски
                 (bitmask_traits<Bitmask>::size).
             \tparam Map
-                Ассоциативный контейнер, хранящий отображение элементов образца в битовые маски.
+                Ассоциативный контейнер, хранящий отображение элементов образца в битовые маски,
+                или метка flat_bitmask_map. По умолчанию для однобайтовых элементов берётся массив,
+                для остальных целых чисел — flat_bitmask_map, а для прочих типов — std::map.
          */
         template
         <
             typename Value,
             typename Bitmask,
-            typename Map = typename std::conditional
-            <
-                std::is_integral<Value>::value && sizeof(Value) == 1,
-                std::array<Bitmask, (1ul << CHAR_BIT)>,
-                std::map<Value, Bitmask>
-            >
-            ::type
+            typename Map = detail::default_bitmask_map_t<Value, Bitmask>
         >
         class bitap
         {
@@ -129,6 +124,24 @@ namespace burst
                 }
             }
 
+            //!     Прочитать очередной элемент текста.
+            /*!
+                    Пересчитывает "подсказку" с учётом элемента, следующего в тексте за всеми уже
+                прочитанными, и возвращает истину, если на этом элементе кончается вхождение
+                образца. Начальная подсказка — нулевая маска.
+             */
+            bool step (bitmask_type & hint, const value_type & element) const
+            {
+                hint = bit_shift(hint) & (*m_bitmask_table)[element];
+                return detail::test_bit<bitmask_type>{}(hint, m_bitmask_table->length() - 1);
+            }
+
+            //!     Длина образца.
+            std::size_t length () const
+            {
+                return m_bitmask_table->length();
+            }
+
         private:
             template <typename ForwardIterator>
             ForwardIterator do_search (ForwardIterator first, ForwardIterator last) const
@@ -180,17 +193,21 @@ namespace burst
             boost::iterator_range<ForwardIterator> active_search (ForwardIterator match_candidate, ForwardIterator corpus_current, ForwardIterator corpus_end, bitmask_type & hint) const
             {
                 // Индикатор совпадения — единица на N-м месте в битовой маске, где N — количество элементов в искомом образце.
-                const bitmask_type match_indicator = static_cast<bitmask_type>(0x01u << (m_bitmask_table->length() - 1));
-                bitmask_type & match_column = hint;
+                const auto match_indicator = m_bitmask_table->length() - 1;
+                const detail::test_bit<bitmask_type> is_match{};
+                // Маска совпадений копируется в локальную переменную, чтобы компилятор мог держать
+                // её в регистрах, а не записывать в память по ссылке на каждом шаге.
+                bitmask_type match_column = hint;
 
-                while (corpus_current != corpus_end && (match_column & match_indicator) == 0)
+                while (corpus_current != corpus_end && not is_match(match_column, match_indicator))
                 {
                     match_column = bit_shift(match_column) & (*m_bitmask_table)[*corpus_current];
                     ++corpus_current;
                     ++match_candidate;
                 }
+                hint = match_column;
 
-                return (match_column & match_indicator) == 0
+                return not is_match(match_column, match_indicator)
                     ? boost::make_iterator_range(corpus_end, corpus_end)
                     : boost::make_iterator_range(match_candidate, corpus_current);
             }
@@ -201,9 +218,9 @@ namespace burst
                 позицию влево (то есть в сторону старшего бита), а затем младший бит
                 устанавливается в единицу.
              */
-            static bitmask_type bit_shift (bitmask_type bitmask)
+            static bitmask_type bit_shift (const bitmask_type & bitmask)
             {
-                return left_shift(bitmask, 1u) | bitmask_type{0b1};
+                return detail::bit_shift<bitmask_type>{}(bitmask);
             }
 
         public:
@@ -225,7 +242,7 @@ namespace burst
         template <typename Bitmask, typename ForwardRange>
         auto make_bitap (const ForwardRange & pattern)
         {
-            return bitap<typename ForwardRange::value_type, Bitmask>(pattern);
+            return bitap<detail::pattern_value_t<typename ForwardRange::value_type>, Bitmask>(pattern);
         }
 
         //!     Функция создания поискового объекта с произвольным отображением.
@@ -236,7 +253,7 @@ namespace burst
         template <typename Bitmask, typename Map, typename ForwardRange>
         auto make_bitap (const ForwardRange & pattern)
         {
-            return bitap<typename ForwardRange::value_type, Bitmask, Map>(pattern);
+            return bitap<detail::pattern_value_t<typename ForwardRange::value_type>, Bitmask, Map>(pattern);
         }
     } // namespace algorithm
 } // namespace burst
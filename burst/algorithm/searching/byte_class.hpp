@@ -0,0 +1,245 @@
+#ifndef BURST_ALGORITHM_SEARCHING_BYTE_CLASS_HPP
+#define BURST_ALGORITHM_SEARCHING_BYTE_CLASS_HPP
+
+#include <burst/algorithm/searching/detail/pattern_element_traits.hpp>
+
+#include <bitset>
+#include <climits>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace burst
+{
+    namespace algorithm
+    {
+        //!     Класс байтов.
+        /*!
+                Множество значений, которые может принимать один элемент образца: одиночный байт,
+            диапазон вроде [0-9], перечисление вроде [abc], дополнение к ним или любой байт.
+                Образец из классов байтов (например, std::vector<byte_class>) можно передать в
+            двоичные алгоритмы поиска с однобайтовыми элементами и таблицей-массивом (bitap,
+            approximate_bitap, multi_bitap) вместо образца из самих байтов, а функции make_bitap,
+            make_approximate_bitap и make_multi_bitap выводят для такого образца тип элементов
+            текста char. Таблица масок строится так же, как и для обычного образца, только бит
+            позиции ставится в маски всех байтов класса, поэтому скорость поиска от классов не
+            зависит.
+         */
+        class byte_class
+        {
+        public:
+            //!     Пустой класс.
+            byte_class () = default;
+
+            //!     Класс из одного байта.
+            byte_class (char byte)
+            {
+                m_bytes.set(index(byte));
+            }
+
+            //!     Любой байт.
+            static byte_class any ()
+            {
+                return ~byte_class{};
+            }
+
+            //!     Все байты от first до last включительно.
+            static byte_class range (char first, char last)
+            {
+                byte_class result;
+                for (auto byte = index(first); byte <= index(last); ++byte)
+                {
+                    result.m_bytes.set(byte);
+                }
+                return result;
+            }
+
+            //!     Все байты, встречающиеся в строке.
+            static byte_class one_of (const std::string & bytes)
+            {
+                byte_class result;
+                for (auto byte: bytes)
+                {
+                    result.m_bytes.set(index(byte));
+                }
+                return result;
+            }
+
+        public:
+            //!     Принадлежит ли байт классу.
+            bool contains (unsigned char byte) const
+            {
+                return m_bytes[byte];
+            }
+
+            //!     Количество байтов в классе.
+            std::size_t count () const
+            {
+                return m_bytes.count();
+            }
+
+            byte_class & operator |= (const byte_class & that)
+            {
+                m_bytes |= that.m_bytes;
+                return *this;
+            }
+
+            friend byte_class operator | (byte_class left, const byte_class & right)
+            {
+                return left |= right;
+            }
+
+            //!     Дополнение класса — все байты, которые в него не входят.
+            friend byte_class operator ~ (byte_class that)
+            {
+                that.m_bytes.flip();
+                return that;
+            }
+
+            friend bool operator == (const byte_class & left, const byte_class & right)
+            {
+                return left.m_bytes == right.m_bytes;
+            }
+
+            friend bool operator != (const byte_class & left, const byte_class & right)
+            {
+                return not (left == right);
+            }
+
+        private:
+            static std::size_t index (char byte)
+            {
+                return static_cast<unsigned char>(byte);
+            }
+
+        private:
+            std::bitset<(1u << CHAR_BIT)> m_bytes;
+        };
+
+        namespace detail
+        {
+            //!     Характеристики класса байтов как элемента образца.
+            /*!
+                    Класс байтов сравнивается с байтами текста (char) и совпадает с каждым байтом,
+                который ему принадлежит.
+             */
+            template <>
+            struct pattern_element_traits <byte_class>
+            {
+                using value_type = char;
+
+                template <typename UnaryFunction>
+                static void for_each_value (const byte_class & bytes, UnaryFunction function)
+                {
+                    for (std::size_t byte = 0; byte < (1u << CHAR_BIT); ++byte)
+                    {
+                        if (bytes.contains(static_cast<unsigned char>(byte)))
+                        {
+                            function(static_cast<char>(byte));
+                        }
+                    }
+                }
+            };
+        } // namespace detail
+
+        //!     Разбор образца из классов байтов.
+        /*!
+                Принимает образец в упрощённом синтаксисе регулярных выражений, в котором каждая
+            единица соответствует ровно одному элементу текста:
+
+                .           — любой байт;
+                [abc]       — один из перечисленных байтов;
+                [a-f0-9]    — байт из одного из диапазонов;
+                [^...]      — любой байт, кроме перечисленных;
+                \x          — байт x как он есть (например, \. или \[);
+                x           — любой другой байт обозначает сам себя.
+
+                Повторения, необязательные элементы и альтернативы меняют длину вхождения и
+            требуют других битовых операций, поэтому не поддерживаются. В случае синтаксической
+            ошибки бросается std::invalid_argument.
+         */
+        inline std::vector<byte_class> make_byte_class_pattern (const std::string & expression)
+        {
+            std::vector<byte_class> pattern;
+
+            auto current = expression.begin();
+            const auto end = expression.end();
+            const auto next = [& current, & end] () -> char
+            {
+                if (current == end)
+                {
+                    throw std::invalid_argument("Образец неожиданно кончился.");
+                }
+                return *current++;
+            };
+
+            while (current != end)
+            {
+                const auto symbol = next();
+                if (symbol == '.')
+                {
+                    pattern.push_back(byte_class::any());
+                }
+                else if (symbol == '\\')
+                {
+                    pattern.emplace_back(next());
+                }
+                else if (symbol == '[')
+                {
+                    byte_class bytes;
+
+                    const auto negated = current != end && *current == '^';
+                    if (negated)
+                    {
+                        ++current;
+                    }
+
+                    // Закрывающая скобка сразу после открывающей — обычный байт, как в POSIX.
+                    auto first = true;
+                    for (auto byte = next(); byte != ']' || first; byte = next())
+                    {
+                        first = false;
+                        if (byte == '\\')
+                        {
+                            byte = next();
+                        }
+
+                        if (current != end && *current == '-' && current + 1 != end && *(current + 1) != ']')
+                        {
+                            ++current;
+                            auto last = next();
+                            if (last == '\\')
+                            {
+                                last = next();
+                            }
+                            if (static_cast<unsigned char>(last) < static_cast<unsigned char>(byte))
+                            {
+                                throw std::invalid_argument("Неверный диапазон в классе байтов.");
+                            }
+                            bytes |= byte_class::range(byte, last);
+                        }
+                        else
+                        {
+                            bytes |= byte_class(byte);
+                        }
+                    }
+
+                    pattern.push_back(negated ? ~bytes : bytes);
+                }
+                else if (symbol == '*' || symbol == '+' || symbol == '?' || symbol == '|' || symbol == '(' || symbol == ')')
+                {
+                    throw std::invalid_argument(std::string("Неподдерживаемый элемент образца: ") + symbol);
+                }
+                else
+                {
+                    pattern.emplace_back(symbol);
+                }
+            }
+
+            return pattern;
+        }
+    } // namespace algorithm
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEARCHING_BYTE_CLASS_HPP
@@ -0,0 +1,145 @@
+#ifndef BURST_ALGORITHM_SEARCHING_DETAIL_BITMASK_OPERATIONS_HPP
+#define BURST_ALGORITHM_SEARCHING_DETAIL_BITMASK_OPERATIONS_HPP
+
+#include <burst/algorithm/searching/detail/bitmask_traits.hpp>
+#include <burst/integer/left_shift.hpp>
+
+#include <bitset>
+#include <cstddef>
+#include <type_traits>
+
+namespace burst
+{
+    namespace algorithm
+    {
+        namespace detail
+        {
+            //!     Главная битовая операция двоичного алгоритма поиска подстроки.
+            /*!
+                    К битовой маске применяется побитовый сдвиг на одну позицию влево (то есть в
+                сторону старшего бита), а затем младший бит устанавливается в единицу.
+                    Метафункцию можно специализировать для тех типов битовых масок, для которых
+                сдвиг с установкой младшего бита делается быстрее, чем сдвиг и отдельное побитовое
+                ИЛИ.
+             */
+            template <typename Bitmask>
+            struct bit_shift
+            {
+                Bitmask operator () (const Bitmask & bitmask) const
+                {
+                    return left_shift(bitmask, 1u) | Bitmask{0b1};
+                }
+            };
+
+            //!     Проверка бита битовой маски.
+            /*!
+                    Возвращает истину, если в битовой маске стоит единица на заданном месте. Так
+                проверяется, кончается ли на текущем элементе текста вхождение образца.
+                    Общая реализация накладывает на маску маску с единственной единицей, что для
+                многословных масок означает проход по всем словам. Специализации проверяют только
+                одно слово.
+             */
+            template <typename Bitmask>
+            struct test_bit
+            {
+                bool operator () (const Bitmask & bitmask, std::size_t position) const
+                {
+                    return (bitmask & left_shift(Bitmask{0b1}, position)) != Bitmask{0};
+                }
+            };
+
+            template <std::size_t Bits>
+            struct test_bit<std::bitset<Bits>>
+            {
+                bool operator () (const std::bitset<Bits> & bitmask, std::size_t position) const
+                {
+                    return bitmask[position];
+                }
+            };
+
+            //!     Номер младшего единичного бита ненулевого беззнакового целого.
+            template <typename Unsigned>
+            std::size_t lowest_set_bit (Unsigned bits)
+            {
+                static_assert(std::is_unsigned<Unsigned>::value && sizeof(Unsigned) <= sizeof(unsigned long long), "");
+#if defined(__GNUC__)
+                return static_cast<std::size_t>(__builtin_ctzll(bits));
+#else
+                std::size_t position = 0;
+                while ((bits & Unsigned{1}) == 0)
+                {
+                    bits >>= 1;
+                    ++position;
+                }
+                return position;
+#endif
+            }
+
+            //!     Обход единичных битов битовой маски.
+            /*!
+                    Вызывает функцию от номера каждого единичного бита маски в порядке возрастания
+                номеров. Так находятся все образцы, вхождения которых кончаются на текущем элементе
+                текста.
+                    Общая реализация проверяет каждый бит маски. Специализации для целых чисел и
+                std::bitset перескакивают сразу к очередной единице, поэтому время обхода
+                пропорционально количеству единиц, а не размеру маски.
+             */
+            template <typename Bitmask, typename = void>
+            struct for_each_set_bit
+            {
+                template <typename UnaryFunction>
+                void operator () (const Bitmask & bitmask, UnaryFunction && function) const
+                {
+                    for (std::size_t position = 0; position < bitmask_traits<Bitmask>::size; ++position)
+                    {
+                        if (test_bit<Bitmask>{}(bitmask, position))
+                        {
+                            function(position);
+                        }
+                    }
+                }
+            };
+
+            template <typename Integer>
+            struct for_each_set_bit<Integer, std::enable_if_t<std::is_integral<Integer>::value>>
+            {
+                template <typename UnaryFunction>
+                void operator () (Integer bitmask, UnaryFunction && function) const
+                {
+                    using unsigned_type = std::make_unsigned_t<Integer>;
+                    auto bits = static_cast<unsigned_type>(bitmask);
+                    while (bits != 0)
+                    {
+                        function(lowest_set_bit(bits));
+                        bits = static_cast<unsigned_type>(bits & (bits - 1));
+                    }
+                }
+            };
+
+            template <std::size_t Bits>
+            struct for_each_set_bit<std::bitset<Bits>>
+            {
+                template <typename UnaryFunction>
+                void operator () (const std::bitset<Bits> & bitmask, UnaryFunction && function) const
+                {
+#if defined(__GLIBCXX__)
+                    for (auto position = bitmask._Find_first(); position < Bits; position = bitmask._Find_next(position))
+                    {
+                        function(position);
+                    }
+#else
+                    for (std::size_t position = 0; position < Bits; ++position)
+                    {
+                        if (bitmask[position])
+                        {
+                            function(position);
+                        }
+                    }
+#endif
+                }
+            };
+        } // namespace detail
+    } // namespace algorithm
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEARCHING_DETAIL_BITMASK_OPERATIONS_HPP
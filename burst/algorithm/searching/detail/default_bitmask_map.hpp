@@ -0,0 +1,40 @@
+#ifndef BURST_ALGORITHM_SEARCHING_DETAIL_DEFAULT_BITMASK_MAP_HPP
+#define BURST_ALGORITHM_SEARCHING_DETAIL_DEFAULT_BITMASK_MAP_HPP
+
+#include <burst/algorithm/searching/flat_bitmask_map.hpp>
+
+#include <array>
+#include <climits>
+#include <map>
+#include <type_traits>
+
+namespace burst
+{
+    namespace algorithm
+    {
+        namespace detail
+        {
+            //!     Отображение элементов образца в битовые маски, выбираемое по умолчанию.
+            /*!
+                    1. Для однобайтовых целых чисел — массив, индексируемый самим элементом.
+                    2. Для остальных целых чисел — плоская хеш-таблица (flat_bitmask_map).
+                    3. Для всех прочих типов — std::map.
+             */
+            template <typename Value, typename Bitmask>
+            using default_bitmask_map_t =
+                std::conditional_t
+                <
+                    std::is_integral<Value>::value && sizeof(Value) == 1,
+                    std::array<Bitmask, (1ul << CHAR_BIT)>,
+                    std::conditional_t
+                    <
+                        std::is_integral<Value>::value,
+                        flat_bitmask_map<Value, Bitmask>,
+                        std::map<Value, Bitmask>
+                    >
+                >;
+        } // namespace detail
+    } // namespace algorithm
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEARCHING_DETAIL_DEFAULT_BITMASK_MAP_HPP
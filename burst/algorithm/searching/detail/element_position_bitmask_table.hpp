@@ -1,6 +1,8 @@
 #ifndef BURST_ALGORITHM_SEARCHING_DETAIL_ELEMENT_POSITION_BITMASK_TABLE_HPP
 #define BURST_ALGORITHM_SEARCHING_DETAIL_ELEMENT_POSITION_BITMASK_TABLE_HPP
 
+#include <burst/algorithm/searching/detail/pattern_element_traits.hpp>
+
 #include <array>
 #include <cstddef>
 #include <initializer_list>
@@ -120,6 +122,8 @@ namespace burst
                 однобайтовых чисел.
                     В этом случае можно в качестве отображения взять обычный массив и обращаться к
                 нему просто по индексам.
+                    Элемент исходной последовательности может соответствовать нескольким байтам
+                (см. pattern_element_traits). Тогда бит позиции ставится в маски всех этих байтов.
              */
             template <typename Bitmask, std::size_t Size>
             class element_position_bitmask_table <std::array<Bitmask, Size>>
@@ -155,14 +159,19 @@ namespace burst
                 void initialize (InputIterator first, InputIterator last)
                 {
                     using iterated_type = typename std::iterator_traits<InputIterator>::value_type;
-                    static_assert(std::is_integral<iterated_type>::value && sizeof(iterated_type) == 1, "Входной элемент должен быть однобайтовым целым числом.");
+                    using value_type = pattern_value_t<iterated_type>;
+                    static_assert(std::is_integral<value_type>::value && sizeof(value_type) == 1, "Входной элемент должен соответствовать однобайтовым целым числам.");
 
                     std::size_t elements_count = 0;
 
                     bitmask_type position_indicator = 0x01;
                     while (first != last)
                     {
-                        m_bitmasks[static_cast<unsigned char>(*first)] |= position_indicator;
+                        pattern_element_traits<iterated_type>::for_each_value(*first,
+                            [this, & position_indicator] (value_type byte)
+                            {
+                                m_bitmasks[static_cast<unsigned char>(byte)] |= position_indicator;
+                            });
 
                         ++first;
                         position_indicator = static_cast<bitmask_type>(position_indicator << 1);
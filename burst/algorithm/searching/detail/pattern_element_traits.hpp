@@ -0,0 +1,38 @@
+#ifndef BURST_ALGORITHM_SEARCHING_DETAIL_PATTERN_ELEMENT_TRAITS_HPP
+#define BURST_ALGORITHM_SEARCHING_DETAIL_PATTERN_ELEMENT_TRAITS_HPP
+
+namespace burst
+{
+    namespace algorithm
+    {
+        namespace detail
+        {
+            //!     Характеристики элемента образца.
+            /*!
+                    Метафункция, описывающая, каким элементам текста соответствует элемент образца.
+                    Содержит тип "value_type" — тип элементов текста, а также функцию
+                "for_each_value", которая вызывает заданную функцию от каждого значения типа
+                "value_type", совпадающего с элементом образца.
+                    В общем случае элемент образца совпадает только с самим собой. Если элемент
+                образца может совпадать с несколькими значениями (например, класс байтов), то
+                нужно создать специализацию этого класса.
+             */
+            template <typename Element>
+            struct pattern_element_traits
+            {
+                using value_type = Element;
+
+                template <typename UnaryFunction>
+                static void for_each_value (const Element & element, UnaryFunction function)
+                {
+                    function(element);
+                }
+            };
+
+            template <typename Element>
+            using pattern_value_t = typename pattern_element_traits<Element>::value_type;
+        } // namespace detail
+    } // namespace algorithm
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEARCHING_DETAIL_PATTERN_ELEMENT_TRAITS_HPP
@@ -0,0 +1,263 @@
+#ifndef BURST_ALGORITHM_SEARCHING_FLAT_BITMASK_MAP_HPP
+#define BURST_ALGORITHM_SEARCHING_FLAT_BITMASK_MAP_HPP
+
+#include <burst/algorithm/searching/detail/element_position_bitmask_table.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    namespace algorithm
+    {
+        //!     Плоское отображение элементов образца в битовые маски.
+        /*!
+                Метка, которую можно передать в качестве отображения ("Map") в bitap и другие
+            двоичные алгоритмы поиска. Таблица позиционных масок с такой меткой — это хеш-таблица
+            с открытой адресацией, которая строится один раз по образцу: ключи и маски лежат в двух
+            плоских массивах, а хеш-функция подбирается так, чтобы любой элемент находился за одну
+            или несколько проб, количество которых известно заранее.
+                Подходит для элементов, для которых определены std::hash и сравнение на равенство,
+            и прежде всего для целых чисел шире байта.
+
+            \tparam Key
+                Тип элементов образца.
+            \tparam Bitmask
+                Тип битовой маски.
+         */
+        template <typename Key, typename Bitmask>
+        struct flat_bitmask_map
+        {
+            using key_type = Key;
+            using mapped_type = Bitmask;
+        };
+
+        namespace detail
+        {
+            //!     Позиционные маски элементов в плоской хеш-таблице.
+            /*!
+                    Размер таблицы — степень двойки, не меньшая удвоенного количества уникальных
+                элементов образца. Место элемента — старшие биты произведения его хеша на нечётный
+                множитель, а при коллизии элемент кладётся на следующее свободное место.
+                    При построении перебирается несколько множителей и выбирается тот, при котором
+                наибольшее удаление элемента от своего места минимально. Обычно удаётся найти
+                множитель вовсе без коллизий, и тогда поиск любого элемента — ровно одна проба:
+                одно сравнение ключа и чтение маски.
+                    Поиск никогда не смотрит дальше наибольшего удаления, поэтому элемент, которого
+                нет в образце, тоже находится за фиксированное количество проб. Пустые места
+                содержат нулевую маску, поэтому совпадение с ключом пустого места тоже даёт ноль.
+
+                    Асимптотика.
+
+                Построение: O(M * R), M — длина образца, R — количество опробованных множителей.
+                Поиск: O(L), L — наибольшее удаление, обычно равное единице.
+                Память: O(U), U — количество уникальных элементов образца.
+             */
+            template <typename Key, typename Bitmask>
+            class element_position_bitmask_table<algorithm::flat_bitmask_map<Key, Bitmask>>
+            {
+            public:
+                using key_type = Key;
+                using bitmask_type = Bitmask;
+
+            public:
+                template <typename InputIterator>
+                element_position_bitmask_table (InputIterator sequence_begin, InputIterator sequence_end)
+                {
+                    initialize(sequence_begin, sequence_end);
+                }
+
+                template <typename InputRange>
+                explicit element_position_bitmask_table (const InputRange & sequence)
+                {
+                    initialize(sequence.begin(), sequence.end());
+                }
+
+                element_position_bitmask_table (std::initializer_list<key_type> sequence)
+                {
+                    initialize(sequence.begin(), sequence.end());
+                }
+
+            private:
+                template <typename InputIterator>
+                void initialize (InputIterator first, InputIterator last)
+                {
+                    using iterated_type = typename std::iterator_traits<InputIterator>::value_type;
+                    static_assert(std::is_same<iterated_type, key_type>::value, "Неверно задан тип входного элемента.");
+
+                    std::unordered_map<key_type, bitmask_type> bitmasks;
+                    std::vector<key_type> elements;
+
+                    std::size_t elements_count = 0;
+
+                    bitmask_type position_indicator = 0x01;
+                    while (first != last)
+                    {
+                        const auto inserted = bitmasks.emplace(*first, bitmask_type{0});
+                        if (inserted.second)
+                        {
+                            elements.push_back(*first);
+                        }
+                        inserted.first->second |= position_indicator;
+
+                        ++first;
+                        position_indicator = static_cast<bitmask_type>(position_indicator << 1);
+                        ++elements_count;
+                    }
+
+                    m_sequence_length = elements_count;
+                    m_size = elements.size();
+
+                    std::size_t slot_bits = 1;
+                    while ((std::size_t{1} << slot_bits) < 2 * elements.size())
+                    {
+                        ++slot_bits;
+                    }
+                    m_shift = hash_bits - slot_bits;
+                    m_slot_mask = (std::size_t{1} << slot_bits) - 1;
+
+                    choose_multiplier(elements);
+
+                    m_keys.assign(m_slot_mask + 1, key_type{});
+                    m_bitmasks.assign(m_slot_mask + 1, bitmask_type{0});
+                    std::vector<bool> occupied(m_slot_mask + 1, false);
+                    for (const auto & element: elements)
+                    {
+                        auto slot = slot_of(element);
+                        while (occupied[slot])
+                        {
+                            slot = (slot + 1) & m_slot_mask;
+                        }
+                        occupied[slot] = true;
+                        m_keys[slot] = element;
+                        m_bitmasks[slot] = bitmasks[element];
+                    }
+                }
+
+                //!     Выбор множителя хеш-функции.
+                /*!
+                        Для каждого множителя-кандидата элементы раскладываются по таблице, и
+                    запоминается наибольшее количество проб, нужное для поиска элемента. Перебор
+                    прекращается, как только найден множитель без коллизий.
+                 */
+                void choose_multiplier (const std::vector<key_type> & elements)
+                {
+                    std::uint64_t candidate = 0x9e3779b97f4a7c15ull;
+
+                    m_multiplier = candidate;
+                    m_probe_limit = std::numeric_limits<std::size_t>::max();
+                    for (std::size_t attempt = 0; attempt < multiplier_attempts && m_probe_limit > 1; ++attempt)
+                    {
+                        const auto probe_limit = probe_limit_for(candidate, elements);
+                        if (probe_limit < m_probe_limit)
+                        {
+                            m_multiplier = candidate;
+                            m_probe_limit = probe_limit;
+                        }
+
+                        // Шаг генератора splitmix64; младший бит взводится, чтобы множитель был нечётным.
+                        candidate += 0x9e3779b97f4a7c15ull;
+                        auto mixed = candidate;
+                        mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ull;
+                        mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebull;
+                        candidate = (mixed ^ (mixed >> 31)) | 1u;
+                    }
+                    m_probe_limit = std::max<std::size_t>(m_probe_limit, 1);
+                }
+
+                std::size_t probe_limit_for (std::uint64_t multiplier, const std::vector<key_type> & elements) const
+                {
+                    std::vector<bool> occupied(m_slot_mask + 1, false);
+                    std::size_t probe_limit = 0;
+                    for (const auto & element: elements)
+                    {
+                        auto slot = slot_of(element, multiplier);
+                        std::size_t probes = 1;
+                        while (occupied[slot])
+                        {
+                            slot = (slot + 1) & m_slot_mask;
+                            ++probes;
+                        }
+                        occupied[slot] = true;
+                        probe_limit = std::max(probe_limit, probes);
+                    }
+                    return probe_limit;
+                }
+
+                std::size_t slot_of (const key_type & element, std::uint64_t multiplier) const
+                {
+                    const auto hash = static_cast<std::uint64_t>(std::hash<key_type>{}(element));
+                    return static_cast<std::size_t>((hash * multiplier) >> m_shift);
+                }
+
+                std::size_t slot_of (const key_type & element) const
+                {
+                    return slot_of(element, m_multiplier);
+                }
+
+            public:
+                //!     Взять битовую маску для элемента.
+                /*!
+                        Возвращает битовую маску положений заданного элемента в исходной
+                    последовательности или нулевую маску, если элемента в ней не было.
+                 */
+                bitmask_type operator [] (const key_type & element) const
+                {
+                    auto slot = slot_of(element);
+                    for (std::size_t probe = 0; probe < m_probe_limit; ++probe)
+                    {
+                        if (m_keys[slot] == element)
+                        {
+                            return m_bitmasks[slot];
+                        }
+                        slot = (slot + 1) & m_slot_mask;
+                    }
+                    return bitmask_type{0};
+                }
+
+                //!     Длина исходной последовательности.
+                std::size_t length () const
+                {
+                    return m_sequence_length;
+                }
+
+                //!     Количество уникальных элементов исходной последовательности.
+                std::size_t size () const
+                {
+                    return m_size;
+                }
+
+                //!     Наибольшее количество проб при поиске элемента.
+                std::size_t probe_limit () const
+                {
+                    return m_probe_limit;
+                }
+
+            private:
+                static const std::size_t hash_bits = 64;
+                static const std::size_t multiplier_attempts = 32;
+
+            private:
+                std::vector<key_type> m_keys;
+                std::vector<bitmask_type> m_bitmasks;
+                std::uint64_t m_multiplier;
+                std::size_t m_shift;
+                std::size_t m_slot_mask;
+                std::size_t m_probe_limit;
+                std::size_t m_sequence_length;
+                std::size_t m_size;
+            };
+        } // namespace detail
+    } // namespace algorithm
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEARCHING_FLAT_BITMASK_MAP_HPP
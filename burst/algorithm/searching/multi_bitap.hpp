@@ -0,0 +1,207 @@
+#ifndef BURST_ALGORITHM_SEARCHING_MULTI_BITAP_HPP
+#define BURST_ALGORITHM_SEARCHING_MULTI_BITAP_HPP
+
+#include <burst/algorithm/searching/detail/bitmask_operations.hpp>
+#include <burst/algorithm/searching/detail/bitmask_traits.hpp>
+#include <burst/algorithm/searching/detail/default_bitmask_map.hpp>
+#include <burst/algorithm/searching/detail/element_position_bitmask_table.hpp>
+#include <burst/algorithm/searching/detail/pattern_element_traits.hpp>
+#include <burst/integer/left_shift.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    namespace algorithm
+    {
+        //!     Двоичный алгоритм поиска нескольких образцов за один проход.
+        /*!
+                Образцы записываются в одну битовую маску друг за другом: i-й образец занимает биты
+            с o_i по o_i + |P_i| - 1, где o_i — суммарная длина предыдущих образцов. Тогда таблица
+            позиционных масок объединения образцов — это просто таблица позиционных масок их
+            конкатенации, а шаг поиска отличается от шага обычного "bitap" только тем, что после
+            сдвига единица ставится не в один младший бит, а в первый бит каждого образца. Бит,
+            перенесённый сдвигом из последнего бита одного образца в первый бит следующего, ничего
+            не портит: первый бит образца и так устанавливается на каждом шаге.
+                Вхождение образца кончается на текущем элементе текста, если в маске стоит единица в
+            последнем бите этого образца. Поэтому один шаг проверяет все образцы сразу, и время
+            поиска пропорционально длине текста, а не количеству образцов, пока суммарная длина
+            образцов помещается в маску.
+
+                Асимптотика.
+
+            Время: O(T * W + M), T — длина текста, W — количество машинных слов в битовой маске,
+                M — количество вхождений.
+            Память: O(L), L — суммарная длина образцов.
+
+            \tparam Value
+                Тип элементов образцов и текста.
+            \tparam Bitmask
+                Тип битовой маски (см. bitap). Суммарная длина образцов не должна превышать её
+                размер, поэтому для многих образцов обычно берётся std::bitset.
+            \tparam Map
+                Ассоциативный контейнер, хранящий отображение элементов образцов в битовые маски.
+         */
+        template
+        <
+            typename Value,
+            typename Bitmask,
+            typename Map = detail::default_bitmask_map_t<Value, Bitmask>
+        >
+        class multi_bitap
+        {
+        public:
+            using value_type = Value;
+            using bitmask_type = Bitmask;
+            using map_type = Map;
+            using bitmask_table_type = detail::element_position_bitmask_table<map_type>;
+
+        public:
+            //!     Создание поискового объекта из набора образцов.
+            /*!
+                    Принимает диапазон образцов, каждый из которых — непустой диапазон элементов.
+                Элементами образцов могут быть как сами значения типа "Value", так и элементы,
+                соответствующие нескольким значениям (например, классы байтов).
+                    Номер образца, который сообщается при поиске, — это его номер в этом диапазоне.
+             */
+            template <typename ForwardRange>
+            explicit multi_bitap (const ForwardRange & patterns):
+                m_start_mask{0},
+                m_match_mask{0}
+            {
+                using pattern_type = typename boost::range_value<ForwardRange>::type;
+                using element_type = typename boost::range_value<pattern_type>::type;
+
+                std::vector<element_type> concatenation;
+                for (const auto & pattern: patterns)
+                {
+                    BOOST_ASSERT(pattern.begin() != pattern.end());
+
+                    const auto offset = concatenation.size();
+                    concatenation.insert(concatenation.end(), pattern.begin(), pattern.end());
+                    BOOST_ASSERT(concatenation.size() <= bitmask_size);
+
+                    const auto last_bit = concatenation.size() - 1;
+                    m_start_mask |= left_shift(bitmask_type{0b1}, offset);
+                    m_match_mask |= left_shift(bitmask_type{0b1}, last_bit);
+                    m_lengths.push_back(concatenation.size() - offset);
+                    m_pattern_by_last_bit.resize(concatenation.size());
+                    m_pattern_by_last_bit[last_bit] = m_lengths.size() - 1;
+                }
+
+                m_bitmask_table =
+                    std::make_shared<const bitmask_table_type>(concatenation.begin(), concatenation.end());
+            }
+
+        public:
+            //!     Поиск всех вхождений всех образцов в текст.
+            /*!
+                    Проходит по тексту, заданному полуинтервалом [corpus_begin, corpus_end), и для
+                каждого вхождения вызывает функцию "match" от двух аргументов: номера образца и
+                позиции начала вхождения, отсчитанной от начала текста. Вхождения сообщаются в
+                порядке возрастания их концов, а вхождения с общим концом — в порядке возрастания
+                номеров образцов.
+                    Возвращает функцию "match".
+             */
+            template <typename ForwardIterator, typename BinaryFunction>
+            BinaryFunction
+                operator ()
+                (
+                    ForwardIterator corpus_begin,
+                    ForwardIterator corpus_end,
+                    BinaryFunction match
+                ) const
+            {
+                using iterated_type = typename std::iterator_traits<ForwardIterator>::value_type;
+                static_assert(std::is_same<iterated_type, value_type>::value, "Тип элементов обыскиваемой последовательности должен совпадать с типом элементов образцов.");
+
+                bitmask_type match_column{0};
+                std::size_t position = 0;
+                while (corpus_begin != corpus_end)
+                {
+                    match_column = (left_shift(match_column, 1u) | m_start_mask) & (*m_bitmask_table)[*corpus_begin];
+                    ++corpus_begin;
+                    ++position;
+
+                    const bitmask_type ends = match_column & m_match_mask;
+                    if (ends != bitmask_type{0})
+                    {
+                        report(ends, position, match);
+                    }
+                }
+
+                return match;
+            }
+
+            //!     Количество образцов.
+            std::size_t size () const
+            {
+                return m_lengths.size();
+            }
+
+            //!     Длина образца с заданным номером.
+            std::size_t length (std::size_t pattern) const
+            {
+                return m_lengths[pattern];
+            }
+
+        private:
+            //!     Сообщение о вхождениях, кончающихся в заданном месте текста.
+            /*!
+                    Обходит только единичные биты маски концов вхождений, а номер образца находит по
+                номеру его последнего бита, поэтому время не зависит от количества образцов.
+             */
+            template <typename BinaryFunction>
+            void report (const bitmask_type & ends, std::size_t end, BinaryFunction & match) const
+            {
+                detail::for_each_set_bit<bitmask_type>{}(ends,
+                    [this, end, & match] (std::size_t last_bit)
+                    {
+                        const auto pattern = m_pattern_by_last_bit[last_bit];
+                        match(pattern, end - m_lengths[pattern]);
+                    });
+            }
+
+        public:
+            static const std::size_t bitmask_size = detail::bitmask_traits<bitmask_type>::size;
+
+        private:
+            std::shared_ptr<const bitmask_table_type> m_bitmask_table;
+            // Единицы в первых битах всех образцов.
+            bitmask_type m_start_mask;
+            // Единицы в последних битах всех образцов.
+            bitmask_type m_match_mask;
+            std::vector<std::size_t> m_lengths;
+            // Номер образца по номеру его последнего бита.
+            std::vector<std::size_t> m_pattern_by_last_bit;
+        };
+
+        //!     Функция создания поискового объекта для нескольких образцов.
+        /*!
+                Принимает явно заданный тип битовой маски и диапазон образцов.
+         */
+        template <typename Bitmask, typename ForwardRange>
+        auto make_multi_bitap (const ForwardRange & patterns)
+        {
+            using pattern_type = typename ForwardRange::value_type;
+            return multi_bitap<detail::pattern_value_t<typename pattern_type::value_type>, Bitmask>(patterns);
+        }
+
+        //!     Функция создания поискового объекта для нескольких образцов с произвольным отображением.
+        template <typename Bitmask, typename Map, typename ForwardRange>
+        auto make_multi_bitap (const ForwardRange & patterns)
+        {
+            using pattern_type = typename ForwardRange::value_type;
+            return multi_bitap<detail::pattern_value_t<typename pattern_type::value_type>, Bitmask, Map>(patterns);
+        }
+    } // namespace algorithm
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEARCHING_MULTI_BITAP_HPP
@@ -0,0 +1,167 @@
+#ifndef BURST_ALGORITHM_SEARCHING_PARALLEL_FIND_ALL_HPP
+#define BURST_ALGORITHM_SEARCHING_PARALLEL_FIND_ALL_HPP
+
+#include <burst/algorithm/searching/bitap.hpp>
+#include <burst/container/detail/thread_group.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace burst
+{
+    namespace algorithm
+    {
+        namespace detail
+        {
+            //!     Поиск всех вхождений, начинающихся в заданном куске текста.
+            /*!
+                    Ищет вхождения образца, начала которых лежат в полуинтервале
+                [text_begin + first, text_begin + last), и дописывает их позиции в конец "matches".
+                    Чтобы найти вхождения, которые начинаются у конца куска, но заканчиваются уже за
+                ним, просматривается |P| - 1 элемент после конца куска. Вхождения, которые
+                начинаются в этом нахлёсте, найдены быть не могут: для этого нужно было бы выйти за
+                просматриваемую область. Поэтому каждое вхождение находится ровно одним куском.
+             */
+            template <typename Value, typename Bitmask, typename Map, typename RandomAccessIterator>
+            void
+                find_all_in_part
+                (
+                    const bitap<Value, Bitmask, Map> & search,
+                    RandomAccessIterator text_begin,
+                    std::size_t text_size,
+                    std::size_t first,
+                    std::size_t last,
+                    std::vector<std::size_t> & matches
+                )
+            {
+                using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+                const auto part_begin = text_begin + static_cast<difference_type>(first);
+                const auto part_end = text_begin + static_cast<difference_type>(std::min(last + search.length() - 1, text_size));
+
+                Bitmask hint = 0;
+                auto match = search.find_first(part_begin, part_end, hint);
+                while (not match.empty())
+                {
+                    matches.push_back(static_cast<std::size_t>(match.begin() - text_begin));
+                    match = search.find_next(match.begin(), match.end(), part_end, hint);
+                }
+            }
+        } // namespace detail
+
+        //!     Параллельный поиск всех вхождений образца в текст.
+        /*!
+                Делит текст на thread_count кусков примерно одинакового размера и ищет в каждом
+            куске в отдельном потоке. Двоичный алгоритм помнит только последние |P| элементов
+            текста, поэтому соседние куски достаточно перекрыть на |P| - 1 элемент. Каждый кусок
+            отвечает только за вхождения, которые в нём начинаются, поэтому вхождение на стыке
+            кусков не теряется и не повторяется.
+                Возвращает позиции начал всех вхождений в порядке возрастания — ровно те же, что и
+            последовательный обход всех вхождений.
+                Если система не может создать очередной поток, оставшиеся куски обыскиваются в
+            вызывающем потоке. Исключение, брошенное при обработке любого куска (например,
+            std::bad_alloc при записи вхождений), перебрасывается в вызывающий поток после того,
+            как завершатся все потоки.
+
+                Асимптотика.
+
+            Время: O(N / T + T |P|), N — длина текста, T — количество потоков.
+            Память: O(T + K), K — количество вхождений.
+
+            \param search
+                Поисковый объект с непустым образцом.
+            \param text
+                Текст с произвольным доступом.
+            \param thread_count
+                Количество потоков, включая вызывающий. По-умолчанию берётся количество потоков,
+                которые аппаратура может выполнять одновременно.
+         */
+        template <typename Value, typename Bitmask, typename Map, typename RandomAccessRange>
+        std::vector<std::size_t>
+            parallel_find_all
+            (
+                const bitap<Value, Bitmask, Map> & search,
+                const RandomAccessRange & text,
+                std::size_t thread_count = std::thread::hardware_concurrency()
+            )
+        {
+            BOOST_ASSERT(search.length() > 0);
+
+            const auto text_begin = boost::begin(text);
+            const auto text_size = static_cast<std::size_t>(std::distance(text_begin, boost::end(text)));
+            if (text_size < search.length())
+            {
+                return {};
+            }
+
+            // Количество мест, на которых может начинаться вхождение.
+            const auto start_count = text_size - search.length() + 1;
+            thread_count = std::max<std::size_t>(1, std::min(thread_count, start_count));
+            const auto part_size = (start_count + thread_count - 1) / thread_count;
+
+            std::vector<std::vector<std::size_t>> part_matches(thread_count);
+            std::vector<std::exception_ptr> part_errors(thread_count);
+            const auto find_in_part =
+                [& search, text_begin, text_size, start_count, part_size, & part_matches, & part_errors] (std::size_t part)
+                {
+                    try
+                    {
+                        const auto first = std::min(part * part_size, start_count);
+                        const auto last = std::min(first + part_size, start_count);
+                        detail::find_all_in_part(search, text_begin, text_size, first, last, part_matches[part]);
+                    }
+                    catch (...)
+                    {
+                        part_errors[part] = std::current_exception();
+                    }
+                };
+
+            burst::detail::thread_group threads(thread_count - 1);
+            std::size_t part = 1;
+            while (part < thread_count && threads.try_spawn([& find_in_part, part] {find_in_part(part);}))
+            {
+                ++part;
+            }
+
+            find_in_part(0);
+            for (; part < thread_count; ++part)
+            {
+                find_in_part(part);
+            }
+            threads.join();
+
+            for (const auto & error: part_errors)
+            {
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+
+            std::size_t match_count = 0;
+            for (const auto & matches: part_matches)
+            {
+                match_count += matches.size();
+            }
+
+            std::vector<std::size_t> result;
+            result.reserve(match_count);
+            for (const auto & matches: part_matches)
+            {
+                result.insert(result.end(), matches.begin(), matches.end());
+            }
+            return result;
+        }
+    } // namespace algorithm
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEARCHING_PARALLEL_FIND_ALL_HPP
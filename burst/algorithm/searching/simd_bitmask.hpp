@@ -0,0 +1,441 @@
+#ifndef BURST_ALGORITHM_SEARCHING_SIMD_BITMASK_HPP
+#define BURST_ALGORITHM_SEARCHING_SIMD_BITMASK_HPP
+
+#include <burst/algorithm/searching/detail/bitmask_operations.hpp>
+#include <burst/algorithm/searching/detail/bitmask_traits.hpp>
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <immintrin.h>
+#endif
+
+namespace burst
+{
+    namespace algorithm
+    {
+        namespace detail
+        {
+            //!     Операции над частью векторной битовой маски.
+            /*!
+                    Векторная битовая маска хранится как массив частей — векторных регистров или,
+                если векторных команд нет, 64-битных слов. Младшая часть хранит младшие биты.
+                    Специализация для каждого типа части содержит:
+                    1. Побитовые И и ИЛИ и проверку на равенство нулю.
+                    2. Начальный перенос — единицу, которая ставится в младший бит маски при сдвиге.
+                    3. Сдвиг части на один бит влево: в младший бит части ставится перенос из
+                       предыдущей части, а в перенос записывается старший бит самой части. Перенос
+                       вычисляется из исходной части, а не из результата, поэтому части одной
+                       маски сдвигаются независимо друг от друга.
+             */
+            template <typename Chunk>
+            struct simd_chunk_operations;
+
+            template <>
+            struct simd_chunk_operations<std::uint64_t>
+            {
+                using chunk_type = std::uint64_t;
+
+                static chunk_type bitwise_and (chunk_type left, chunk_type right)
+                {
+                    return left & right;
+                }
+
+                static chunk_type bitwise_or (chunk_type left, chunk_type right)
+                {
+                    return left | right;
+                }
+
+                static bool is_zero (chunk_type chunk)
+                {
+                    return chunk == 0;
+                }
+
+                static chunk_type initial_carry ()
+                {
+                    return 1;
+                }
+
+                static chunk_type shift_in (chunk_type chunk, chunk_type & carry)
+                {
+                    const auto result = (chunk << 1) | carry;
+                    carry = chunk >> 63;
+                    return result;
+                }
+            };
+
+#if defined(__SSE2__) && defined(__GNUC__)
+            // Векторные регистры с выравниванием слова: маски лежат в таблицах, память под которые
+            // выделяет оператор new, а он не обязан выравнивать её по размеру регистра. Регистр
+            // обёрнут в структуру, потому что атрибуты типа теряются при подстановке в шаблон.
+            using simd_vector_128 = long long __attribute__((__vector_size__(16), __aligned__(8)));
+
+            struct simd_chunk_128
+            {
+                simd_vector_128 value;
+            };
+
+            template <>
+            struct simd_chunk_operations<simd_chunk_128>
+            {
+                using chunk_type = simd_chunk_128;
+
+                static chunk_type bitwise_and (chunk_type left, chunk_type right)
+                {
+                    return {_mm_and_si128(left.value, right.value)};
+                }
+
+                static chunk_type bitwise_or (chunk_type left, chunk_type right)
+                {
+                    return {_mm_or_si128(left.value, right.value)};
+                }
+
+                static bool is_zero (chunk_type chunk)
+                {
+                    return _mm_movemask_epi8(_mm_cmpeq_epi8(chunk.value, _mm_setzero_si128())) == 0xffff;
+                }
+
+                static chunk_type initial_carry ()
+                {
+                    return {_mm_set_epi64x(0, 1)};
+                }
+
+                //!     Сдвиг 128 битов.
+                /*!
+                        Перенос из младшего слова регистра в старшее делается побайтовым сдвигом
+                    регистра на 8 байтов вверх, а перенос из старшего слова уходит в следующий
+                    регистр побайтовым сдвигом вниз.
+                 */
+                static chunk_type shift_in (chunk_type chunk, chunk_type & carry)
+                {
+                    const auto carries = _mm_srli_epi64(chunk.value, 63);
+                    const auto result =
+                        _mm_or_si128(_mm_or_si128(_mm_slli_epi64(chunk.value, 1), _mm_slli_si128(carries, 8)), carry.value);
+                    carry.value = _mm_srli_si128(carries, 8);
+                    return {result};
+                }
+            };
+#endif
+
+#if defined(__AVX2__) && defined(__GNUC__)
+            using simd_vector_256 = long long __attribute__((__vector_size__(32), __aligned__(8)));
+
+            struct simd_chunk_256
+            {
+                simd_vector_256 value;
+            };
+
+            template <>
+            struct simd_chunk_operations<simd_chunk_256>
+            {
+                using chunk_type = simd_chunk_256;
+
+                static chunk_type bitwise_and (chunk_type left, chunk_type right)
+                {
+                    return {_mm256_and_si256(left.value, right.value)};
+                }
+
+                static chunk_type bitwise_or (chunk_type left, chunk_type right)
+                {
+                    return {_mm256_or_si256(left.value, right.value)};
+                }
+
+                static bool is_zero (chunk_type chunk)
+                {
+                    return _mm256_testz_si256(chunk.value, chunk.value) != 0;
+                }
+
+                static chunk_type initial_carry ()
+                {
+                    return {_mm256_set_epi64x(0, 0, 0, 1)};
+                }
+
+                //!     Сдвиг 256 битов.
+                /*!
+                        Старшие биты слов регистра сдвигаются в младшие разряды, после чего
+                    перестановка слов (3, 0, 1, 2) ставит перенос из каждого слова на место
+                    следующего слова, а перенос из старшего слова регистра — на место младшего.
+                    Последний заменяется переносом из предыдущего регистра и сам становится
+                    переносом в следующий регистр.
+                 */
+                static chunk_type shift_in (chunk_type chunk, chunk_type & carry)
+                {
+                    const auto carries =
+                        _mm256_permute4x64_epi64(_mm256_srli_epi64(chunk.value, 63), _MM_SHUFFLE(2, 1, 0, 3));
+                    const auto result =
+                        _mm256_or_si256(_mm256_slli_epi64(chunk.value, 1), _mm256_blend_epi32(carries, carry.value, 0x03));
+                    carry.value = carries;
+                    return {result};
+                }
+            };
+#endif
+
+            //!     Тип части векторной битовой маски из заданного количества битов.
+            /*!
+                    Самый широкий векторный регистр, размер которого делит размер маски, или
+                64-битное слово, если векторных команд нет.
+             */
+            template <std::size_t Bits>
+            using simd_chunk_t =
+#if defined(__AVX2__) && defined(__GNUC__)
+                std::conditional_t<Bits % 256 == 0, simd_chunk_256, simd_chunk_128>;
+#elif defined(__SSE2__) && defined(__GNUC__)
+                simd_chunk_128;
+#else
+                std::uint64_t;
+#endif
+        } // namespace detail
+
+        //!     Векторная битовая маска.
+        /*!
+                Битовая маска из 128, 256, 512 и т.д. битов для поиска образцов, которые не
+            помещаются в машинное слово. Хранится в векторных регистрах: при AVX2 — в 256-битных
+            (а маска из 128 битов — в одном 128-битном), при SSE2 — в 128-битных, а без векторных
+            команд — в 64-битных словах.
+                Главная операция двоичного поиска — сдвиг на один бит с установкой младшего бита —
+            выполняется над целыми регистрами: каждое 64-битное слово сдвигается само по себе, а
+            старшие биты слов переставляются на место младших битов следующих слов (см.
+            simd_chunk_operations). В отличие от std::bitset, маска не индексируется в памяти ни в
+            одной операции поиска, поэтому компилятор держит её в регистрах.
+                Регистры хранятся без сверхвыравнивания, поэтому маски можно держать в таблицах,
+            память под которые выделяет оператор new.
+
+            \tparam Bits
+                Количество битов. Должно быть кратно 128.
+         */
+        template <std::size_t Bits>
+        class simd_bitmask
+        {
+        public:
+            using word_type = std::uint64_t;
+            static const std::size_t word_size = sizeof(word_type) * CHAR_BIT;
+            static const std::size_t word_count = Bits / word_size;
+
+            static_assert(Bits > 0 && Bits % 128 == 0, "Размер векторной битовой маски должен быть кратен 128.");
+
+        private:
+            using chunk_type = detail::simd_chunk_t<Bits>;
+            using operations = detail::simd_chunk_operations<chunk_type>;
+            static const std::size_t chunk_count = sizeof(word_type) * word_count / sizeof(chunk_type);
+
+        public:
+            simd_bitmask ():
+                simd_bitmask(0)
+            {
+            }
+
+            //!     Создание маски из целого числа.
+            /*!
+                    Число записывается в младшее слово, остальные слова нулевые. Преобразование
+                неявное, как и у std::bitset, чтобы маску можно было сравнивать с нулём и
+                инициализировать целыми числами.
+             */
+            simd_bitmask (unsigned long long value)
+            {
+                const std::array<word_type, word_count> words{{static_cast<word_type>(value)}};
+                std::memcpy(&m_chunks, &words, sizeof(m_chunks));
+            }
+
+        public:
+            simd_bitmask & operator &= (const simd_bitmask & that)
+            {
+                for (std::size_t i = 0; i < chunk_count; ++i)
+                {
+                    m_chunks[i] = operations::bitwise_and(m_chunks[i], that.m_chunks[i]);
+                }
+                return *this;
+            }
+
+            simd_bitmask & operator |= (const simd_bitmask & that)
+            {
+                for (std::size_t i = 0; i < chunk_count; ++i)
+                {
+                    m_chunks[i] = operations::bitwise_or(m_chunks[i], that.m_chunks[i]);
+                }
+                return *this;
+            }
+
+            //!     Сдвиг влево на произвольное количество битов.
+            /*!
+                    Нужен только при построении таблиц масок, поэтому выполняется по словам:
+                каждое слово результата собирается из двух слов исходной маски.
+             */
+            simd_bitmask & operator <<= (std::size_t shift)
+            {
+                auto words = this->words();
+                const auto word_shift = shift / word_size;
+                const auto bit_shift = shift % word_size;
+
+                for (std::size_t i = word_count; i-- > 0; )
+                {
+                    word_type word = 0;
+                    if (i >= word_shift)
+                    {
+                        word = words[i - word_shift] << bit_shift;
+                        if (bit_shift != 0 && i > word_shift)
+                        {
+                            word |= words[i - word_shift - 1] >> (word_size - bit_shift);
+                        }
+                    }
+                    words[i] = word;
+                }
+
+                std::memcpy(&m_chunks, &words, sizeof(m_chunks));
+                return *this;
+            }
+
+            //!     Сдвиг на один бит влево с установкой младшего бита.
+            simd_bitmask shifted_in_one () const
+            {
+                simd_bitmask result;
+                auto carry = operations::initial_carry();
+                for (std::size_t i = 0; i < chunk_count; ++i)
+                {
+                    result.m_chunks[i] = operations::shift_in(m_chunks[i], carry);
+                }
+                return result;
+            }
+
+            //!     Значение бита с заданным номером.
+            /*!
+                    Часть маски выбирается перебором, а не индексом: обращение к части по номеру,
+                известному только во время исполнения, заставило бы компилятор держать маску в
+                памяти, и на каждом шаге поиска маска записывалась бы в память и читалась обратно.
+             */
+            bool test (std::size_t position) const
+            {
+                const auto chunk_size = sizeof(chunk_type) * CHAR_BIT;
+                const auto index = position / chunk_size;
+
+                auto chunk = m_chunks[0];
+                for (std::size_t i = 1; i < chunk_count; ++i)
+                {
+                    chunk = i == index ? m_chunks[i] : chunk;
+                }
+
+                std::array<word_type, sizeof(chunk_type) / sizeof(word_type)> words;
+                std::memcpy(&words, &chunk, sizeof(chunk));
+
+                const auto bit = position % chunk_size;
+                return ((words[bit / word_size] >> (bit % word_size)) & word_type{1}) != 0;
+            }
+
+            //!     Есть ли в маске хотя бы одна единица.
+            bool any () const
+            {
+                auto result = m_chunks[0];
+                for (std::size_t i = 1; i < chunk_count; ++i)
+                {
+                    result = operations::bitwise_or(result, m_chunks[i]);
+                }
+                return not operations::is_zero(result);
+            }
+
+            //!     Слова маски, начиная с младшего.
+            std::array<word_type, word_count> words () const
+            {
+                std::array<word_type, word_count> result;
+                std::memcpy(&result, &m_chunks, sizeof(m_chunks));
+                return result;
+            }
+
+        public:
+            friend simd_bitmask operator & (simd_bitmask left, const simd_bitmask & right)
+            {
+                return left &= right;
+            }
+
+            friend simd_bitmask operator | (simd_bitmask left, const simd_bitmask & right)
+            {
+                return left |= right;
+            }
+
+            friend simd_bitmask operator << (simd_bitmask bitmask, std::size_t shift)
+            {
+                return bitmask <<= shift;
+            }
+
+            friend bool operator == (const simd_bitmask & left, const simd_bitmask & right)
+            {
+                return left.words() == right.words();
+            }
+
+            friend bool operator != (const simd_bitmask & left, const simd_bitmask & right)
+            {
+                return not (left == right);
+            }
+
+        private:
+            std::array<chunk_type, chunk_count> m_chunks;
+        };
+
+        template <std::size_t Bits>
+        const std::size_t simd_bitmask<Bits>::word_size;
+
+        template <std::size_t Bits>
+        const std::size_t simd_bitmask<Bits>::word_count;
+
+        template <std::size_t Bits>
+        const std::size_t simd_bitmask<Bits>::chunk_count;
+
+        namespace detail
+        {
+            //!     Характеристики векторной битовой маски.
+            template <std::size_t Bits>
+            struct bitmask_traits<simd_bitmask<Bits>>
+            {
+                static const std::size_t size = Bits;
+            };
+
+            //!     Главная битовая операция для векторной битовой маски.
+            /*!
+                    Сдвиг и установка младшего бита выполняются за один проход по регистрам маски.
+             */
+            template <std::size_t Bits>
+            struct bit_shift<simd_bitmask<Bits>>
+            {
+                simd_bitmask<Bits> operator () (const simd_bitmask<Bits> & bitmask) const
+                {
+                    return bitmask.shifted_in_one();
+                }
+            };
+
+            template <std::size_t Bits>
+            struct test_bit<simd_bitmask<Bits>>
+            {
+                bool operator () (const simd_bitmask<Bits> & bitmask, std::size_t position) const
+                {
+                    return bitmask.test(position);
+                }
+            };
+
+            template <std::size_t Bits>
+            struct for_each_set_bit<simd_bitmask<Bits>>
+            {
+                template <typename UnaryFunction>
+                void operator () (const simd_bitmask<Bits> & bitmask, UnaryFunction && function) const
+                {
+                    using word_type = typename simd_bitmask<Bits>::word_type;
+
+                    const auto words = bitmask.words();
+                    for (std::size_t i = 0; i < words.size(); ++i)
+                    {
+                        auto bits = words[i];
+                        while (bits != 0)
+                        {
+                            function(i * simd_bitmask<Bits>::word_size + lowest_set_bit(bits));
+                            bits = static_cast<word_type>(bits & (bits - 1));
+                        }
+                    }
+                }
+            };
+        } // namespace detail
+    } // namespace algorithm
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEARCHING_SIMD_BITMASK_HPP
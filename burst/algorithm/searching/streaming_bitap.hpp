@@ -0,0 +1,153 @@
+#ifndef BURST_ALGORITHM_SEARCHING_STREAMING_BITAP_HPP
+#define BURST_ALGORITHM_SEARCHING_STREAMING_BITAP_HPP
+
+#include <burst/algorithm/searching/bitap.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace algorithm
+    {
+        //!     Потоковый двоичный поиск подстроки.
+        /*!
+                Ищет образец в тексте, который поступает по частям: из сокета, из файла, читаемого
+            блоками, и т.п. Очередная часть текста передаётся в функцию "feed", а между вызовами
+            хранится только битовая маска состояния и количество уже прочитанных элементов.
+            Поэтому вхождения, которые начинаются в одной части, а кончаются в другой, находятся
+            так же, как и внутри одной части, и весь текст не нужно держать в памяти.
+                О каждом вхождении сообщается функции-обработчику, которой передаётся смещение
+            начала вхождения от начала всего текста.
+                Часть текста может быть любым однопроходным диапазоном, в том числе диапазоном
+            бинарного ввода (см. make_binary_istream_range), так что элементы можно брать прямо
+            из потока без промежуточного буфера.
+
+                Асимптотика.
+
+            Время: O(N) на весь текст, N — длина текста.
+            Память: O(1) помимо таблицы масок образца.
+
+            \tparam Value
+                Тип элементов образца и текста.
+            \tparam Bitmask
+                Тип битовой маски.
+            \tparam Map
+                Отображение элементов образца в битовые маски (см. bitap).
+         */
+        template
+        <
+            typename Value,
+            typename Bitmask,
+            typename Map = detail::default_bitmask_map_t<Value, Bitmask>
+        >
+        class streaming_bitap
+        {
+        public:
+            using searcher_type = bitap<Value, Bitmask, Map>;
+            using value_type = typename searcher_type::value_type;
+            using bitmask_type = typename searcher_type::bitmask_type;
+
+        public:
+            explicit streaming_bitap (searcher_type searcher):
+                m_searcher(std::move(searcher)),
+                m_hint(0),
+                m_offset(0)
+            {
+            }
+
+        public:
+            //!     Обработать очередную часть текста.
+            /*!
+                    Принимает полуинтервал [first, last) — часть текста, следующую за всеми ранее
+                обработанными, — и функцию-обработчик с интерфейсом
+
+                    void (std::size_t match_offset)
+
+                которая вызывается для каждого вхождения образца, кончающегося в этой части, в
+                порядке возрастания смещений.
+             */
+            template <typename InputIterator, typename MatchFunction>
+            void feed (InputIterator first, InputIterator last, MatchFunction && match)
+            {
+                using iterated_type = typename std::iterator_traits<InputIterator>::value_type;
+                static_assert(std::is_same<iterated_type, value_type>::value, "Тип элементов текста должен совпадать с типом элементов образца.");
+
+                // Состояние копируется в локальные переменные, чтобы компилятор мог держать их в
+                // регистрах на протяжении всей части текста.
+                auto hint = m_hint;
+                auto offset = m_offset;
+                const auto length = m_searcher.length();
+
+                while (first != last)
+                {
+                    const auto found = m_searcher.step(hint, *first);
+                    ++first;
+                    ++offset;
+
+                    if (found)
+                    {
+                        match(offset - length);
+                    }
+                }
+
+                m_hint = hint;
+                m_offset = offset;
+            }
+
+            //!     Обработать очередную часть текста, заданную диапазоном.
+            template <typename InputRange, typename MatchFunction>
+            void feed (InputRange && block, MatchFunction && match)
+            {
+                feed(boost::begin(block), boost::end(block), std::forward<MatchFunction>(match));
+            }
+
+            //!     Количество обработанных элементов текста.
+            std::size_t offset () const
+            {
+                return m_offset;
+            }
+
+            //!     Начать поиск в новом тексте.
+            void reset ()
+            {
+                m_hint = 0;
+                m_offset = 0;
+            }
+
+            const searcher_type & searcher () const
+            {
+                return m_searcher;
+            }
+
+        private:
+            searcher_type m_searcher;
+            bitmask_type m_hint;
+            std::size_t m_offset;
+        };
+
+        //!     Функция создания потокового поиска из готового поискового объекта.
+        template <typename Value, typename Bitmask, typename Map>
+        auto make_streaming_bitap (bitap<Value, Bitmask, Map> searcher)
+        {
+            return streaming_bitap<Value, Bitmask, Map>(std::move(searcher));
+        }
+
+        //!     Функция создания потокового поиска по образцу.
+        /*!
+                Принимает явно заданный тип битовой маски и образец в виде диапазона.
+         */
+        template <typename Bitmask, typename ForwardRange>
+        auto make_streaming_bitap (const ForwardRange & pattern)
+        {
+            return make_streaming_bitap(make_bitap<Bitmask>(pattern));
+        }
+    } // namespace algorithm
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEARCHING_STREAMING_BITAP_HPP
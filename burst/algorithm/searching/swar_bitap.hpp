@@ -0,0 +1,448 @@
+#ifndef BURST_ALGORITHM_SEARCHING_SWAR_BITAP_HPP
+#define BURST_ALGORITHM_SEARCHING_SWAR_BITAP_HPP
+
+#include <burst/algorithm/searching/detail/bitmask_operations.hpp>
+
+#include <boost/assert.hpp>
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace burst
+{
+    namespace algorithm
+    {
+        //!     Двоичный поиск короткого образца сразу в нескольких местах текста.
+        /*!
+                Предназначен для текстов из однобайтовых элементов и образцов длиной не более 32.
+                Обычный двоичный поиск на каждом элементе текста делает сдвиг и побитовое И над
+            маской, которая зависит от маски на предыдущем элементе, поэтому скорость поиска
+            ограничена длиной этой цепочки зависимостей, а не количеством операций.
+                Здесь 64-битное слово делится на несколько дорожек по 8, 16 или 32 бита — самых
+            узких, в которые помещается образец, — и каждая дорожка ведёт поиск в своём куске
+            текста. Сдвиг и И выполняются над всем словом сразу, так что за одну итерацию
+            обрабатывается по одному элементу в каждой дорожке, а цепочка зависимостей становится
+            короче во столько раз, сколько дорожек в слове. Бит, выдвинутый из старшего разряда
+            дорожки, попадает в младший разряд соседней, который всё равно сразу же
+            устанавливается в единицу, поэтому сдвигать дорожки по отдельности не нужно.
+                Текст обрабатывается блоками. Каждая дорожка отвечает за вхождения, которые
+            начинаются в её куске блока, и для этого просматривает ещё |P| - 1 элемент за концом
+            куска. Остаток текста, на который не хватило целого блока, просматривается обычным
+            последовательным поиском.
+                Если текст лежит в памяти подряд (указатели, итераторы std::vector и std::string),
+            а процессор поддерживает векторные команды (SSE2 или AVX2), то используется векторное
+            ядро: за одну итерацию 16 или 32 места текста одновременно проверяются на совпадение
+            первого и последнего элементов образца, и только прошедшие эту проверку места
+            сверяются с образцом целиком. Для образца из отдельных байтов поиск по полубайтовым
+            таблицам (pshufb) вырождается в сравнение байтов, поэтому используется сравнение —
+            одна команда вместо пяти. Если же ложных кандидатов слишком много (маленький
+            алфавит), то остаток текста обыскивается по дорожкам. Описанный выше поиск по
+            дорожкам — переносимая замена векторному ядру для остальных случаев.
+
+                Асимптотика.
+
+            Время: O(N), N — длина текста. Векторное ядро сверяет с образцом не больше одного
+                ложного кандидата на 32 элемента текста (не считая постоянного запаса в начале),
+                а затем уступает место поиску по дорожкам.
+            Память: O(1), таблица масок фиксированного размера.
+
+            \tparam Value
+                Тип элементов образца и текста. Должен занимать один байт.
+         */
+        template <typename Value>
+        class swar_bitap
+        {
+        public:
+            using value_type = Value;
+
+            static_assert(sizeof(value_type) == 1, "Элементы образца должны занимать один байт.");
+
+        private:
+            using word_type = std::uint64_t;
+            using index_type = typename std::make_unsigned<value_type>::type;
+
+            static const std::size_t word_size = sizeof(word_type) * CHAR_BIT;
+
+        public:
+            template <typename InputIterator>
+            swar_bitap (InputIterator pattern_begin, InputIterator pattern_end):
+                m_bitmasks{{}},
+                m_pattern{{}},
+                m_length(0)
+            {
+                initialize(pattern_begin, pattern_end);
+            }
+
+            template <typename ForwardRange>
+            explicit swar_bitap (const ForwardRange & pattern):
+                m_bitmasks{{}},
+                m_pattern{{}},
+                m_length(0)
+            {
+                initialize(pattern.begin(), pattern.end());
+            }
+
+        private:
+            template <typename InputIterator>
+            void initialize (InputIterator first, InputIterator last)
+            {
+                using iterated_type = typename std::iterator_traits<InputIterator>::value_type;
+                static_assert(std::is_same<iterated_type, value_type>::value, "Неверно задан тип входного элемента.");
+
+                std::uint32_t position_indicator = 0x01;
+                while (first != last)
+                {
+                    BOOST_ASSERT(m_length < max_length);
+                    m_bitmasks[static_cast<index_type>(*first)] |= position_indicator;
+                    m_pattern[m_length] = *first;
+
+                    position_indicator <<= 1;
+                    ++m_length;
+                    ++first;
+                }
+                BOOST_ASSERT(m_length > 0);
+            }
+
+        public:
+            //!     Поиск образца в тексте.
+            /*!
+                    Возвращает итератор на первое вхождение образца в текст, заданный
+                полуинтервалом [corpus_begin, corpus_end), или corpus_end, если вхождений нет.
+             */
+            template <typename RandomAccessIterator>
+            RandomAccessIterator operator () (RandomAccessIterator corpus_begin, RandomAccessIterator corpus_end) const
+            {
+                using iterated_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+                static_assert(std::is_same<iterated_type, value_type>::value, "Тип элементов обыскиваемой последовательности должен совпадать с типом элементов образца.");
+
+                return find_first(corpus_begin, corpus_end, is_contiguous<RandomAccessIterator>{});
+            }
+
+            //!     Длина образца.
+            std::size_t length () const
+            {
+                return m_length;
+            }
+
+        private:
+            //!     Проверка того, что элементы текста лежат в памяти подряд.
+            template <typename Iterator>
+            using is_contiguous =
+                std::integral_constant
+                <
+                    bool,
+                    std::is_pointer<Iterator>::value ||
+                    std::is_same<Iterator, typename std::vector<value_type>::iterator>::value ||
+                    std::is_same<Iterator, typename std::vector<value_type>::const_iterator>::value ||
+                    std::is_same<Iterator, std::string::iterator>::value ||
+                    std::is_same<Iterator, std::string::const_iterator>::value
+                >;
+
+#if defined(__SSE2__)
+            template <typename RandomAccessIterator>
+            RandomAccessIterator find_first (RandomAccessIterator corpus_begin, RandomAccessIterator corpus_end, std::true_type) const
+            {
+                if (corpus_begin == corpus_end)
+                {
+                    return corpus_end;
+                }
+
+                const auto corpus = std::addressof(*corpus_begin);
+                const auto corpus_size = static_cast<std::size_t>(corpus_end - corpus_begin);
+                const auto match = search_vector(reinterpret_cast<const char *>(corpus), corpus_size);
+                return corpus_begin + static_cast<typename std::iterator_traits<RandomAccessIterator>::difference_type>(match);
+            }
+#endif
+
+            template <typename RandomAccessIterator, typename Contiguous>
+            RandomAccessIterator find_first (RandomAccessIterator corpus_begin, RandomAccessIterator corpus_end, Contiguous) const
+            {
+                if (m_length <= 8)
+                {
+                    return search<8>(corpus_begin, corpus_end);
+                }
+                else if (m_length <= 16)
+                {
+                    return search<16>(corpus_begin, corpus_end);
+                }
+                else
+                {
+                    return search<32>(corpus_begin, corpus_end);
+                }
+            }
+
+#if defined(__SSE2__)
+            //!     Векторный поиск в тексте, лежащем в памяти подряд.
+            /*!
+                    Возвращает смещение начала первого вхождения от начала текста или размер
+                текста, если вхождений нет. Места, для которых не хватило целого вектора,
+                просматриваются последовательным поиском.
+             */
+            std::size_t search_vector (const char * corpus, std::size_t corpus_size) const
+            {
+                const auto last_offset = m_length - 1;
+                if (corpus_size <= last_offset)
+                {
+                    return corpus_size;
+                }
+                // Количество мест, на которых может начинаться вхождение.
+                const auto start_count = corpus_size - last_offset;
+                const auto first_element = static_cast<char>(m_pattern[0]);
+                const auto last_element = static_cast<char>(m_pattern[last_offset]);
+
+                std::size_t position = 0;
+                std::size_t rejected = 0;
+#if defined(__AVX2__)
+                const auto wide_first = _mm256_set1_epi8(first_element);
+                const auto wide_last = _mm256_set1_epi8(last_element);
+                for (; position + 32 <= start_count; position += 32)
+                {
+                    const auto heads = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(corpus + position));
+                    const auto tails = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(corpus + position + last_offset));
+                    const auto candidates = _mm256_and_si256(_mm256_cmpeq_epi8(heads, wide_first), _mm256_cmpeq_epi8(tails, wide_last));
+                    const auto match = verify(corpus + position, static_cast<std::uint32_t>(_mm256_movemask_epi8(candidates)), rejected);
+                    if (match != no_match)
+                    {
+                        return position + match;
+                    }
+                    if (too_many_rejected(rejected, position))
+                    {
+                        return position + search_lanes(corpus + position, corpus + corpus_size);
+                    }
+                }
+#endif
+                const auto narrow_first = _mm_set1_epi8(first_element);
+                const auto narrow_last = _mm_set1_epi8(last_element);
+                for (; position + 16 <= start_count; position += 16)
+                {
+                    const auto heads = _mm_loadu_si128(reinterpret_cast<const __m128i *>(corpus + position));
+                    const auto tails = _mm_loadu_si128(reinterpret_cast<const __m128i *>(corpus + position + last_offset));
+                    const auto candidates = _mm_and_si128(_mm_cmpeq_epi8(heads, narrow_first), _mm_cmpeq_epi8(tails, narrow_last));
+                    const auto match = verify(corpus + position, static_cast<std::uint32_t>(_mm_movemask_epi8(candidates)), rejected);
+                    if (match != no_match)
+                    {
+                        return position + match;
+                    }
+                    if (too_many_rejected(rejected, position))
+                    {
+                        return position + search_lanes(corpus + position, corpus + corpus_size);
+                    }
+                }
+
+                return position + static_cast<std::size_t>(search_tail(corpus + position, corpus + corpus_size) - (corpus + position));
+            }
+
+            //!     Сверка мест-кандидатов с образцом.
+            /*!
+                    Единичные биты маски кандидатов отмечают места, отсчитанные от "block", у
+                которых совпали первый и последний элементы образца. Возвращает смещение первого
+                места, где совпал весь образец, или no_match. Количество отвергнутых кандидатов
+                прибавляется к "rejected".
+             */
+            std::size_t verify (const char * block, std::uint32_t candidates, std::size_t & rejected) const
+            {
+                while (candidates != 0)
+                {
+                    const auto offset = detail::lowest_set_bit(candidates);
+                    if (std::memcmp(block + offset, m_pattern.data(), m_length) == 0)
+                    {
+                        return offset;
+                    }
+                    candidates &= candidates - 1;
+                    ++rejected;
+                }
+                return no_match;
+            }
+
+            //!     Слишком ли часто векторный фильтр пропускает ложных кандидатов.
+            /*!
+                    На тексте над маленьким алфавитом первый и последний элементы образца совпадают
+                почти везде, и сверка кандидатов становится дороже, чем побитовый поиск по
+                дорожкам. Поэтому, если на каждые 32 просмотренных элемента в среднем приходится
+                больше одного ложного кандидата (сверх постоянного запаса rejection_allowance),
+                оставшийся текст обыскивается по дорожкам.
+             */
+            static bool too_many_rejected (std::size_t rejected, std::size_t position)
+            {
+                return rejected * 32 > position + rejection_allowance;
+            }
+
+            std::size_t search_lanes (const char * corpus_begin, const char * corpus_end) const
+            {
+                return static_cast<std::size_t>(find_first(corpus_begin, corpus_end, std::false_type{}) - corpus_begin);
+            }
+#endif
+
+            template <std::size_t LaneSize, typename RandomAccessIterator>
+            RandomAccessIterator search (RandomAccessIterator corpus_begin, RandomAccessIterator corpus_end) const
+            {
+                using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+                const auto corpus_size = static_cast<std::size_t>(corpus_end - corpus_begin);
+                const auto steps = part_size + m_length - 1;
+
+                std::size_t block_begin = 0;
+                while (block_begin + block_size<LaneSize>() + m_length - 1 <= corpus_size)
+                {
+                    const auto match = search_block<LaneSize>(corpus_begin + static_cast<difference_type>(block_begin), steps);
+                    if (match != no_match)
+                    {
+                        return corpus_begin + static_cast<difference_type>(block_begin + match);
+                    }
+                    block_begin += block_size<LaneSize>();
+                }
+
+                return search_tail(corpus_begin + static_cast<difference_type>(block_begin), corpus_end);
+            }
+
+            //!     Поиск в блоке из нескольких кусков, по одному на дорожку.
+            /*!
+                    Возвращает смещение начала первого вхождения от начала блока или no_match.
+                Вхождение в дорожке с меньшим номером всегда раньше вхождения в дорожке с большим
+                номером, поэтому поиск прекращается, как только нашлось вхождение в нулевой
+                дорожке, а иначе — в конце блока.
+             */
+            template <std::size_t LaneSize, typename RandomAccessIterator>
+            std::size_t search_block (RandomAccessIterator block, std::size_t steps) const
+            {
+                using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+                constexpr auto lane_count = word_size / LaneSize;
+
+                const auto lane_ones = repeat<LaneSize>(word_type{1});
+                const auto match_indicators = repeat<LaneSize>(word_type{1} << (m_length - 1));
+
+                std::array<std::size_t, lane_count> lane_matches;
+                lane_matches.fill(no_match);
+
+                word_type column = 0;
+                for (std::size_t step = 0; step < steps; ++step)
+                {
+                    word_type element_masks = 0;
+                    for (std::size_t lane = 0; lane < lane_count; ++lane)
+                    {
+                        const auto element = block[static_cast<difference_type>(lane * part_size + step)];
+                        element_masks |= word_type{m_bitmasks[static_cast<index_type>(element)]} << (lane * LaneSize);
+                    }
+                    column = ((column << 1) | lane_ones) & element_masks;
+
+                    if ((column & match_indicators) != 0)
+                    {
+                        for (std::size_t lane = 0; lane < lane_count; ++lane)
+                        {
+                            const auto lane_column = column >> (lane * LaneSize);
+                            if (lane_matches[lane] == no_match && ((lane_column >> (m_length - 1)) & 1) != 0)
+                            {
+                                lane_matches[lane] = lane * part_size + step + 1 - m_length;
+                            }
+                        }
+                        if (lane_matches[0] != no_match)
+                        {
+                            return lane_matches[0];
+                        }
+                    }
+                }
+
+                for (auto match: lane_matches)
+                {
+                    if (match != no_match)
+                    {
+                        return match;
+                    }
+                }
+                return no_match;
+            }
+
+            //!     Последовательный поиск в остатке текста.
+            template <typename RandomAccessIterator>
+            RandomAccessIterator search_tail (RandomAccessIterator first, RandomAccessIterator last) const
+            {
+                const auto match_indicator = std::uint32_t{1} << (m_length - 1);
+
+                std::uint32_t column = 0;
+                while (first != last)
+                {
+                    column = ((column << 1) | 1u) & m_bitmasks[static_cast<index_type>(*first)];
+                    ++first;
+
+                    if ((column & match_indicator) != 0)
+                    {
+                        return first - static_cast<typename std::iterator_traits<RandomAccessIterator>::difference_type>(m_length);
+                    }
+                }
+                return last;
+            }
+
+            template <std::size_t LaneSize>
+            static constexpr std::size_t block_size ()
+            {
+                return part_size * (word_size / LaneSize);
+            }
+
+            //!     Слово, в каждой дорожке которого записано одно и то же значение.
+            template <std::size_t LaneSize>
+            static word_type repeat (word_type value)
+            {
+                word_type result = 0;
+                for (std::size_t lane = 0; lane < word_size / LaneSize; ++lane)
+                {
+                    result |= value << (lane * LaneSize);
+                }
+                return result;
+            }
+
+        public:
+            static const std::size_t max_length = 32;
+
+        private:
+            // Длина куска текста, который просматривает одна дорожка. Каждая дорожка вдобавок
+            // просматривает |P| - 1 элемент следующего куска, так что чем длиннее кусок, тем
+            // меньше лишней работы, но тем больше остаток текста, который ищется без дорожек.
+            static const std::size_t part_size = 256;
+            static const std::size_t no_match = static_cast<std::size_t>(-1);
+            // Сколько ложных кандидатов векторный поиск терпит в начале текста, прежде чем
+            // сравнивать их количество с длиной просмотренного текста.
+            static const std::size_t rejection_allowance = 4096;
+
+        private:
+            std::array<std::uint32_t, 1u << CHAR_BIT> m_bitmasks;
+            std::array<value_type, max_length> m_pattern;
+            std::size_t m_length;
+        };
+
+        template <typename Value>
+        const std::size_t swar_bitap<Value>::word_size;
+
+        template <typename Value>
+        const std::size_t swar_bitap<Value>::max_length;
+
+        template <typename Value>
+        const std::size_t swar_bitap<Value>::part_size;
+
+        template <typename Value>
+        const std::size_t swar_bitap<Value>::no_match;
+
+        template <typename Value>
+        const std::size_t swar_bitap<Value>::rejection_allowance;
+
+        //!     Функция создания поискового объекта.
+        template <typename ForwardRange>
+        auto make_swar_bitap (const ForwardRange & pattern)
+        {
+            return swar_bitap<typename ForwardRange::value_type>(pattern);
+        }
+    } // namespace algorithm
+} // namespace burst
+
+#endif // BURST_ALGORITHM_SEARCHING_SWAR_BITAP_HPP
@@ -0,0 +1,106 @@
+#ifndef BURST_ALGORITHM_TOP_WEIGHTED_SEMIINTERSECT_HPP
+#define BURST_ALGORITHM_TOP_WEIGHTED_SEMIINTERSECT_HPP
+
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/weighted_semiintersect_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    //!     Наиболее тяжёлые элементы взвешенного полупересечения.
+    /*!
+            Принимает на вход набор упорядоченных диапазонов, набор их весов, количество искомых
+        элементов и операцию, задающую отношение строгого порядка на элементах диапазонов.
+            Возвращает вектор из не более чем "count" пар из элемента и его веса, упорядоченный по
+        убыванию веса. Веса — это суммы весов диапазонов, в которых есть элемент.
+
+            Алгоритм работы.
+
+        1. Элементы перебираются итератором взвешенного полупересечения с нулевым порогом.
+        2. Лучшие элементы хранятся в пирамиде, на вершине которой наименее тяжёлый из них.
+        3. Как только пирамида заполнена, порог итератора поднимается до веса вершины пирамиды,
+           причём строго: элемент такого веса всё равно не попал бы в пирамиду. После этого
+           итератор пропускает те участки диапазонов, которые заведомо не могут набрать больший
+           вес.
+
+            Асимптотика.
+
+        Память: O(count).
+     */
+    template <typename RandomAccessRange, typename RandomAccessWeightRange, typename Compare>
+    auto
+        top_weighted_semiintersect
+        (
+            RandomAccessRange ranges,
+            RandomAccessWeightRange weights,
+            std::size_t count,
+            Compare compare
+        )
+    {
+        using iterator_type =
+            weighted_semiintersect_iterator<RandomAccessRange, RandomAccessWeightRange, Compare>;
+        using weight_type = typename iterator_type::weight_type;
+        using value_type = typename iterator_type::value_type;
+
+        std::vector<value_type> top;
+        if (count == 0)
+        {
+            return top;
+        }
+        top.reserve(count);
+
+        const auto heavier =
+            [] (const value_type & left, const value_type & right)
+            {
+                return right.second < left.second;
+            };
+
+        auto current = iterator_type(std::move(ranges), std::move(weights), weight_type{}, compare);
+        const auto end = iterator_type(current, iterator::end_tag);
+        for (/* пусто */; current != end; ++current)
+        {
+            auto item = *current;
+            if (top.size() < count)
+            {
+                top.push_back(std::move(item));
+                std::push_heap(top.begin(), top.end(), heavier);
+            }
+            else if (top.front().second < item.second)
+            {
+                std::pop_heap(top.begin(), top.end(), heavier);
+                top.back() = std::move(item);
+                std::push_heap(top.begin(), top.end(), heavier);
+            }
+            else
+            {
+                continue;
+            }
+
+            if (top.size() == count)
+            {
+                current.raise_threshold_above(top.front().second);
+            }
+        }
+
+        std::sort_heap(top.begin(), top.end(), heavier);
+        return top;
+    }
+
+    //!     Наиболее тяжёлые элементы взвешенного полупересечения.
+    /*!
+            Работает аналогично функции с предикатом, только отношение порядка на элементах
+        диапазонов выбирается по-умолчанию.
+     */
+    template <typename RandomAccessRange, typename RandomAccessWeightRange>
+    auto top_weighted_semiintersect (RandomAccessRange ranges, RandomAccessWeightRange weights, std::size_t count)
+    {
+        return top_weighted_semiintersect(std::move(ranges), std::move(weights), count, std::less<>{});
+    }
+} // namespace burst
+
+#endif // BURST_ALGORITHM_TOP_WEIGHTED_SEMIINTERSECT_HPP
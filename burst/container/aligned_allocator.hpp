@@ -0,0 +1,80 @@
+#ifndef BURST_CONTAINER_ALIGNED_ALLOCATOR_HPP
+#define BURST_CONTAINER_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+namespace burst
+{
+    //!     Распределитель памяти с выравниванием.
+    /*!
+            Выдаёт блоки памяти, начало которых выровнено на границу Alignment байт. Нужен, чтобы
+        разместить данные контейнера с выравниванием, превосходящим выравнивание типа, например,
+        по границе строки кэша.
+            Выделяет через "operator new" на Alignment байт больше, чем нужно, и хранит указатель
+        на исходный блок непосредственно перед выровненным блоком.
+
+        \tparam Value
+            Тип размещаемых элементов.
+        \tparam Alignment
+            Требуемое выравнивание в байтах. Должно быть степенью двойки, не меньшей размера
+            указателя.
+     */
+    template <typename Value, std::size_t Alignment>
+    class aligned_allocator
+    {
+        static_assert((Alignment & (Alignment - 1)) == 0, "Выравнивание должно быть степенью двойки.");
+        static_assert(Alignment >= sizeof(void *), "Выравнивание не должно быть меньше размера указателя.");
+
+    public:
+        using value_type = Value;
+
+        template <typename Other>
+        struct rebind
+        {
+            using other = aligned_allocator<Other, Alignment>;
+        };
+
+        aligned_allocator () = default;
+
+        template <typename Other>
+        aligned_allocator (const aligned_allocator<Other, Alignment> &)
+        {
+        }
+
+        value_type * allocate (std::size_t size)
+        {
+            if (size > (std::numeric_limits<std::size_t>::max() - Alignment) / sizeof(value_type))
+            {
+                throw std::bad_alloc();
+            }
+
+            auto raw = static_cast<char *>(::operator new(size * sizeof(value_type) + Alignment));
+            auto aligned = raw + (Alignment - reinterpret_cast<std::uintptr_t>(raw) % Alignment);
+            reinterpret_cast<void **>(aligned)[-1] = raw;
+
+            return reinterpret_cast<value_type *>(aligned);
+        }
+
+        void deallocate (value_type * pointer, std::size_t)
+        {
+            ::operator delete(reinterpret_cast<void **>(pointer)[-1]);
+        }
+
+        template <typename Other>
+        bool operator == (const aligned_allocator<Other, Alignment> &) const
+        {
+            return true;
+        }
+
+        template <typename Other>
+        bool operator != (const aligned_allocator<Other, Alignment> &) const
+        {
+            return false;
+        }
+    };
+} // namespace burst
+
+#endif // BURST_CONTAINER_ALIGNED_ALLOCATOR_HPP
@@ -0,0 +1,305 @@
+#ifndef BURST_CONTAINER_BUFFERED_K_ARY_SEARCH_SET_HPP
+#define BURST_CONTAINER_BUFFERED_K_ARY_SEARCH_SET_HPP
+
+#include <burst/container/k_ary_node_storage.hpp>
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace burst
+{
+    //!     Изменяемое множество на основе k-местного дерева поиска.
+    /*!
+            Состоит из неизменяемого ядра — k_ary_search_set — и небольшого буфера изменений:
+        упорядоченного массива вставленных элементов, которых нет в ядре, и упорядоченного
+        массива "надгробий" — удалённых элементов ядра.
+            Поиск проверяет сначала буфер вставок, затем ядро, а найденный в ядре элемент — по
+        надгробиям. Вставка и удаление меняют только буфер. Когда размер буфера превышает
+        порог, ядро перестраивается с учётом всех изменений, а буфер очищается.
+            Порог пропорционален квадратному корню из размера множества. Изменение буфера
+        стоит O(D), перестройка ядра — O(N), поэтому при D ~ sqrt(N) вставка и удаление стоят
+        O(sqrt(N)) в среднем, а буфер остаётся настолько маленьким, что поиск в нём почти
+        ничего не добавляет к поиску в ядре.
+
+        \tparam Value
+            Тип данных, хранящихся в множестве.
+        \tparam Compare
+            Отношение порядка на элементах.
+        \tparam NodeStorage
+            Политика хранения узлов ядра (см. k_ary_search_set).
+     */
+    template
+    <
+        typename Value,
+        typename Compare = std::less<Value>,
+        typename NodeStorage = container::packed_nodes
+    >
+    class buffered_k_ary_search_set
+    {
+    public:
+        using value_type = Value;
+        using value_compare = Compare;
+        using core_type = k_ary_search_set<value_type, value_compare, NodeStorage>;
+        using size_type = std::size_t;
+
+    public:
+        template <typename RandomAccessIterator>
+        buffered_k_ary_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_core(container::unique_ordered_tag, first, last, arity, compare),
+            m_compare(compare)
+        {
+        }
+
+        template <typename RandomAccessIterator>
+        buffered_k_ary_search_set
+                (
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_core(first, last, arity, compare),
+            m_compare(compare)
+        {
+        }
+
+        buffered_k_ary_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    std::initializer_list<value_type> values,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_core(container::unique_ordered_tag, values, arity, compare),
+            m_compare(compare)
+        {
+        }
+
+        buffered_k_ary_search_set
+                (
+                    std::initializer_list<value_type> values,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_core(values, arity, compare),
+            m_compare(compare)
+        {
+        }
+
+        explicit buffered_k_ary_search_set (std::size_t arity = default_arity, const value_compare & compare = value_compare()):
+            m_core(container::unique_ordered_tag, std::initializer_list<value_type>{}, arity, compare),
+            m_compare(compare)
+        {
+        }
+
+    public:
+        //!     Поиск элемента в множестве.
+        /*!
+                Возвращает указатель на элемент, равный искомому, или нулевой указатель, если такого
+            элемента нет. Указатель действителен до ближайшего изменения множества.
+
+                Асимптотика.
+
+            Время: O(log_k(N) + log(D)), D — размер буфера изменений.
+            Память: O(1).
+         */
+        const value_type * find (const value_type & value) const
+        {
+            const auto inserted = std::lower_bound(m_inserted.begin(), m_inserted.end(), value, m_compare);
+            if (inserted != m_inserted.end() && not m_compare(value, *inserted))
+            {
+                return &*inserted;
+            }
+
+            const auto found = m_core.find(value);
+            if (found == m_core.end() || is_erased(value))
+            {
+                return nullptr;
+            }
+            return &*found;
+        }
+
+        bool contains (const value_type & value) const
+        {
+            return find(value) != nullptr;
+        }
+
+        //!     Вставка элемента.
+        /*!
+                Возвращает истину, если элемента не было в множестве и он был вставлен, и ложь,
+            если такой элемент уже был.
+
+                Асимптотика.
+
+            Время: O(log_k(N) + D) и O(N) в среднем на перестройку ядра.
+         */
+        bool insert (const value_type & value)
+        {
+            bool inserted = false;
+            if (m_core.find(value) != m_core.end())
+            {
+                const auto erased = std::lower_bound(m_erased.begin(), m_erased.end(), value, m_compare);
+                if (erased != m_erased.end() && not m_compare(value, *erased))
+                {
+                    m_erased.erase(erased);
+                    inserted = true;
+                }
+            }
+            else
+            {
+                const auto position = std::lower_bound(m_inserted.begin(), m_inserted.end(), value, m_compare);
+                if (position == m_inserted.end() || m_compare(value, *position))
+                {
+                    m_inserted.insert(position, value);
+                    inserted = true;
+                }
+            }
+
+            rebuild_if_needed();
+            return inserted;
+        }
+
+        //!     Удаление элемента.
+        /*!
+                Возвращает количество удалённых элементов, то есть единицу, если элемент был в
+            множестве, и ноль, если не было.
+
+                Асимптотика.
+
+            Время: O(log_k(N) + D) и O(N) в среднем на перестройку ядра.
+         */
+        size_type erase (const value_type & value)
+        {
+            size_type erased = 0;
+            const auto inserted = std::lower_bound(m_inserted.begin(), m_inserted.end(), value, m_compare);
+            if (inserted != m_inserted.end() && not m_compare(value, *inserted))
+            {
+                m_inserted.erase(inserted);
+                erased = 1;
+            }
+            else if (m_core.find(value) != m_core.end())
+            {
+                const auto position = std::lower_bound(m_erased.begin(), m_erased.end(), value, m_compare);
+                if (position == m_erased.end() || m_compare(value, *position))
+                {
+                    m_erased.insert(position, value);
+                    erased = 1;
+                }
+            }
+
+            rebuild_if_needed();
+            return erased;
+        }
+
+        //!     Перестройка ядра.
+        /*!
+                Сливает ядро с буфером изменений в новое ядро и очищает буфер. После перестройки
+            ядро содержит ровно элементы множества, и его можно обходить в порядке возрастания.
+
+                Асимптотика.
+
+            Время: O(N + D).
+            Память: O(N + D).
+         */
+        void rebuild ()
+        {
+            if (m_inserted.empty() && m_erased.empty())
+            {
+                return;
+            }
+
+            std::vector<value_type> values;
+            values.reserve(size());
+            std::set_difference
+            (
+                m_core.ordered_begin(), m_core.ordered_end(),
+                m_erased.begin(), m_erased.end(),
+                std::back_inserter(values),
+                m_compare
+            );
+            const auto middle = static_cast<std::ptrdiff_t>(values.size());
+            values.insert(values.end(), m_inserted.begin(), m_inserted.end());
+            std::inplace_merge(values.begin(), values.begin() + middle, values.end(), m_compare);
+
+            m_core = core_type(container::unique_ordered_tag, values.begin(), values.end(), m_core.arity(), m_compare);
+            m_inserted.clear();
+            m_erased.clear();
+        }
+
+        //!     Ядро множества.
+        /*!
+                Содержит элементы множества на момент последней перестройки.
+         */
+        const core_type & core () const
+        {
+            return m_core;
+        }
+
+        //!     Размер буфера изменений.
+        size_type delta_size () const
+        {
+            return m_inserted.size() + m_erased.size();
+        }
+
+        //!     Размер буфера, при превышении которого ядро перестраивается.
+        size_type delta_limit () const
+        {
+            const auto root = static_cast<size_type>(std::sqrt(static_cast<double>(m_core.size())));
+            return std::max(min_delta_limit, root);
+        }
+
+        size_type size () const
+        {
+            return m_core.size() - m_erased.size() + m_inserted.size();
+        }
+
+        bool empty () const
+        {
+            return size() == 0;
+        }
+
+    private:
+        bool is_erased (const value_type & value) const
+        {
+            return not m_erased.empty() && std::binary_search(m_erased.begin(), m_erased.end(), value, m_compare);
+        }
+
+        void rebuild_if_needed ()
+        {
+            if (delta_size() > delta_limit())
+            {
+                rebuild();
+            }
+        }
+
+    private:
+        static const std::size_t default_arity = 33;
+        static const size_type min_delta_limit = 64;
+
+    private:
+        core_type m_core;
+        std::vector<value_type> m_inserted;
+        std::vector<value_type> m_erased;
+        value_compare m_compare;
+    };
+
+    template <typename Value, typename Compare, typename NodeStorage>
+    const typename buffered_k_ary_search_set<Value, Compare, NodeStorage>::size_type
+        buffered_k_ary_search_set<Value, Compare, NodeStorage>::min_delta_limit;
+}
+
+#endif // BURST_CONTAINER_BUFFERED_K_ARY_SEARCH_SET_HPP
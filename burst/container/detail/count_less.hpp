@@ -0,0 +1,139 @@
+#ifndef BURST_CONTAINER_DETAIL_COUNT_LESS_HPP
+#define BURST_CONTAINER_DETAIL_COUNT_LESS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Подсчёт элементов узла, меньших заданного значения.
+        /*!
+                Узел — это массив из Size элементов, упорядоченных по возрастанию, поэтому
+            количество элементов, меньших value, совпадает с индексом нижней грани value в узле.
+                Все Size сравнений выполняются без ветвлений, а компилятор может их
+            векторизовать, поскольку длина цикла известна на этапе компиляции.
+         */
+        template <std::size_t Size, typename Integer, typename = void>
+        struct count_less_impl
+        {
+            static std::size_t apply (const Integer * node, Integer value)
+            {
+                std::size_t count = 0;
+                for (std::size_t i = 0; i < Size; ++i)
+                {
+                    count += static_cast<std::size_t>(node[i] < value);
+                }
+                return count;
+            }
+        };
+
+#if defined(__SSE2__)
+        //!     Подсчёт для 32-битных целых с помощью векторных сравнений.
+        /*!
+                Каждая группа из четырёх (или восьми при наличии AVX2) ключей сравнивается с
+            искомым значением одной командой, маска результатов сравнения собирается в целое
+            число, а количество единичных битов в нём и есть количество меньших ключей.
+                Векторные команды сравнивают только знаковые числа, поэтому у беззнаковых чисел
+            предварительно инвертируется старший бит, что сохраняет порядок.
+         */
+        template <std::size_t Size, typename Integer>
+        struct count_less_impl<Size, Integer, std::enable_if_t<std::is_integral<Integer>::value && sizeof(Integer) == 4>>
+        {
+            static std::size_t apply (const Integer * node, Integer value)
+            {
+                const auto bias = std::is_signed<Integer>::value ? 0 : std::numeric_limits<std::int32_t>::min();
+
+                std::size_t count = 0;
+                std::size_t i = 0;
+#if defined(__AVX2__)
+                const auto wide_bias = _mm256_set1_epi32(bias);
+                const auto wide_value = _mm256_xor_si256(_mm256_set1_epi32(static_cast<std::int32_t>(value)), wide_bias);
+                for (; i + 8 <= Size; i += 8)
+                {
+                    const auto keys = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(node + i));
+                    const auto less = _mm256_cmpgt_epi32(wide_value, _mm256_xor_si256(keys, wide_bias));
+                    const auto mask = _mm256_movemask_ps(_mm256_castsi256_ps(less));
+                    count += static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned>(mask)));
+                }
+#endif
+                const auto narrow_bias = _mm_set1_epi32(bias);
+                const auto narrow_value = _mm_xor_si128(_mm_set1_epi32(static_cast<std::int32_t>(value)), narrow_bias);
+                for (; i + 4 <= Size; i += 4)
+                {
+                    const auto keys = _mm_loadu_si128(reinterpret_cast<const __m128i *>(node + i));
+                    const auto less = _mm_cmplt_epi32(_mm_xor_si128(keys, narrow_bias), narrow_value);
+                    const auto mask = _mm_movemask_ps(_mm_castsi128_ps(less));
+                    count += static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned>(mask)));
+                }
+                // Остаток, не кратный ширине вектора. Начало задано константой, чтобы компилятор
+                // видел, что цикл пуст, когда остатка нет.
+                for (i = Size - Size % 4; i < Size; ++i)
+                {
+                    count += static_cast<std::size_t>(node[i] < value);
+                }
+                return count;
+            }
+        };
+#endif // defined(__SSE2__)
+
+#if defined(__SSE4_2__)
+        //!     Подсчёт для 64-битных целых с помощью векторных сравнений.
+        /*!
+                Аналогичен подсчёту для 32-битных целых, но сравнение 64-битных чисел появилось
+            только в SSE4.2.
+         */
+        template <std::size_t Size, typename Integer>
+        struct count_less_impl<Size, Integer, std::enable_if_t<std::is_integral<Integer>::value && sizeof(Integer) == 8>>
+        {
+            static std::size_t apply (const Integer * node, Integer value)
+            {
+                const auto bias = std::is_signed<Integer>::value ? 0 : std::numeric_limits<std::int64_t>::min();
+
+                std::size_t count = 0;
+                std::size_t i = 0;
+#if defined(__AVX2__)
+                const auto wide_bias = _mm256_set1_epi64x(bias);
+                const auto wide_value = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<std::int64_t>(value)), wide_bias);
+                for (; i + 4 <= Size; i += 4)
+                {
+                    const auto keys = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(node + i));
+                    const auto less = _mm256_cmpgt_epi64(wide_value, _mm256_xor_si256(keys, wide_bias));
+                    const auto mask = _mm256_movemask_pd(_mm256_castsi256_pd(less));
+                    count += static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned>(mask)));
+                }
+#endif
+                const auto narrow_bias = _mm_set1_epi64x(bias);
+                const auto narrow_value = _mm_xor_si128(_mm_set1_epi64x(static_cast<std::int64_t>(value)), narrow_bias);
+                for (; i + 2 <= Size; i += 2)
+                {
+                    const auto keys = _mm_loadu_si128(reinterpret_cast<const __m128i *>(node + i));
+                    const auto less = _mm_cmpgt_epi64(narrow_value, _mm_xor_si128(keys, narrow_bias));
+                    const auto mask = _mm_movemask_pd(_mm_castsi128_pd(less));
+                    count += static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned>(mask)));
+                }
+                for (i = Size - Size % 2; i < Size; ++i)
+                {
+                    count += static_cast<std::size_t>(node[i] < value);
+                }
+                return count;
+            }
+        };
+#endif // defined(__SSE4_2__)
+
+        template <std::size_t Size, typename Integer>
+        std::size_t count_less (const Integer * node, Integer value)
+        {
+            return count_less_impl<Size, Integer>::apply(node, value);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_COUNT_LESS_HPP
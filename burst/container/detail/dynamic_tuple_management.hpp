@@ -56,7 +56,8 @@ namespace burst
             move,
             destroy,
             size,
-            type
+            type,
+            trivially_copyable
         };
 
         using manager_t = void (*) (operation_t, const void *, void *);
@@ -94,6 +95,12 @@ namespace burst
                     *static_cast<const std::type_info **>(destination) = std::addressof(typeid(T));
                     break;
                 }
+                case operation_t::trivially_copyable:
+                {
+                    assert(source == nullptr);
+                    *static_cast<bool *>(destination) = std::is_trivially_copyable<T>::value;
+                    break;
+                }
             }
         }
 
@@ -169,6 +176,15 @@ namespace burst
             return size;
         }
 
+        //!     Можно ли копировать и перемещать объект побайтово, не вызывая менеджера.
+        inline bool is_trivially_copyable (const object_info_t & object)
+        {
+            bool trivially_copyable;
+            object.manage(operation_t::trivially_copyable, nullptr, std::addressof(trivially_copyable));
+
+            return trivially_copyable;
+        }
+
         inline const std::type_info & type (const object_info_t & object)
         {
             const std::type_info * type;
@@ -0,0 +1,213 @@
+#ifndef BURST_CONTAINER_DETAIL_K_ARY_INORDER_ITERATOR_HPP
+#define BURST_CONTAINER_DETAIL_K_ARY_INORDER_ITERATOR_HPP
+
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Итератор по элементам k-местного дерева в порядке возрастания.
+        /*!
+                Положение в дереве задаётся порядковым номером узла и номером элемента в узле.
+            Узлы пронумерованы так же, как в пирамиде: у узла с номером n дети имеют номера с
+            (n * k + 1) по (n * k + k), а родитель — номер (n - 1) / k. Поэтому переходы между
+            узлами — чистая арифметика над номерами, без указателей и без стека.
+                Обход в порядке возрастания — это симметричный обход: i-е поддерево узла, затем
+            i-й элемент узла, затем (i + 1)-е поддерево и т.д. При полном обходе каждое ребро
+            дерева проходится дважды, поэтому переход к следующему элементу стоит O(1) в
+            среднем, а в худшем случае — O(log_k(N)).
+                Концу соответствует положение элемента с номером N, которого в дереве нет.
+
+            \tparam RandomAccessIterator
+                Итератор на начало хранилища узлов. Узел с номером n начинается в хранилище с
+                позиции n * s, где s — шаг между узлами.
+         */
+        template <typename RandomAccessIterator>
+        class k_ary_inorder_iterator:
+            public boost::iterator_facade
+            <
+                k_ary_inorder_iterator<RandomAccessIterator>,
+                std::remove_reference_t<typename std::iterator_traits<RandomAccessIterator>::reference>,
+                boost::bidirectional_traversal_tag,
+                typename std::iterator_traits<RandomAccessIterator>::reference,
+                typename std::iterator_traits<RandomAccessIterator>::difference_type
+            >
+        {
+        private:
+            using base_iterator_type = RandomAccessIterator;
+            using base_type =
+                boost::iterator_facade
+                <
+                    k_ary_inorder_iterator,
+                    std::remove_reference_t<typename std::iterator_traits<base_iterator_type>::reference>,
+                    boost::bidirectional_traversal_tag,
+                    typename std::iterator_traits<base_iterator_type>::reference,
+                    typename std::iterator_traits<base_iterator_type>::difference_type
+                >;
+
+        public:
+            k_ary_inorder_iterator
+                    (
+                        base_iterator_type nodes,
+                        std::size_t size,
+                        std::size_t arity,
+                        std::size_t node_stride,
+                        std::size_t node_number,
+                        std::size_t position
+                    ):
+                m_nodes(nodes),
+                m_size(size),
+                m_arity(arity),
+                m_node_stride(node_stride),
+                m_node_number(node_number),
+                m_position(position)
+            {
+            }
+
+            k_ary_inorder_iterator () = default;
+
+            //!     Номер элемента в дереве, на который указывает итератор.
+            std::size_t index () const
+            {
+                return m_node_number * node_size() + m_position;
+            }
+
+        private:
+            friend class boost::iterator_core_access;
+
+            std::size_t node_size () const
+            {
+                return m_arity - 1;
+            }
+
+            std::size_t child (std::size_t node_number, std::size_t child_number) const
+            {
+                return node_number * m_arity + child_number + 1;
+            }
+
+            bool exists (std::size_t node_number) const
+            {
+                return node_number * node_size() < m_size;
+            }
+
+            std::size_t elements (std::size_t node_number) const
+            {
+                return std::min(node_size(), m_size - node_number * node_size());
+            }
+
+            void set_end ()
+            {
+                m_node_number = m_size / node_size();
+                m_position = m_size % node_size();
+            }
+
+            void descend_to_leftmost ()
+            {
+                while (exists(child(m_node_number, 0)))
+                {
+                    m_node_number = child(m_node_number, 0);
+                }
+                m_position = 0;
+            }
+
+            void descend_to_rightmost ()
+            {
+                while (exists(child(m_node_number, elements(m_node_number))))
+                {
+                    m_node_number = child(m_node_number, elements(m_node_number));
+                }
+                m_position = elements(m_node_number) - 1;
+            }
+
+            typename base_type::reference dereference () const
+            {
+                BOOST_ASSERT(index() < m_size);
+                const auto slot = m_node_number * m_node_stride + m_position;
+                return m_nodes[static_cast<typename base_type::difference_type>(slot)];
+            }
+
+            bool equal (const k_ary_inorder_iterator & that) const
+            {
+                return this->index() == that.index();
+            }
+
+            void increment ()
+            {
+                BOOST_ASSERT(index() < m_size);
+                if (exists(child(m_node_number, m_position + 1)))
+                {
+                    m_node_number = child(m_node_number, m_position + 1);
+                    descend_to_leftmost();
+                }
+                else if (m_position + 1 < elements(m_node_number))
+                {
+                    ++m_position;
+                }
+                else
+                {
+                    while (m_node_number != 0)
+                    {
+                        const auto child_number = (m_node_number - 1) % m_arity;
+                        m_node_number = (m_node_number - 1) / m_arity;
+                        if (child_number < elements(m_node_number))
+                        {
+                            m_position = child_number;
+                            return;
+                        }
+                    }
+                    set_end();
+                }
+            }
+
+            void decrement ()
+            {
+                if (index() == m_size)
+                {
+                    BOOST_ASSERT(m_size > 0);
+                    m_node_number = 0;
+                    descend_to_rightmost();
+                }
+                else if (exists(child(m_node_number, m_position)))
+                {
+                    m_node_number = child(m_node_number, m_position);
+                    descend_to_rightmost();
+                }
+                else if (m_position > 0)
+                {
+                    --m_position;
+                }
+                else
+                {
+                    while (m_node_number != 0)
+                    {
+                        const auto child_number = (m_node_number - 1) % m_arity;
+                        m_node_number = (m_node_number - 1) / m_arity;
+                        if (child_number > 0)
+                        {
+                            m_position = child_number - 1;
+                            return;
+                        }
+                    }
+                    BOOST_ASSERT_MSG(false, "Итератор вышел за начало множества.");
+                }
+            }
+
+        private:
+            base_iterator_type m_nodes;
+            std::size_t m_size;
+            std::size_t m_arity;
+            std::size_t m_node_stride;
+            std::size_t m_node_number;
+            std::size_t m_position;
+        };
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_K_ARY_INORDER_ITERATOR_HPP
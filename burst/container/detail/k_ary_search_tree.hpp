@@ -0,0 +1,208 @@
+#ifndef BURST_CONTAINER_DETAIL_K_ARY_SEARCH_TREE_HPP
+#define BURST_CONTAINER_DETAIL_K_ARY_SEARCH_TREE_HPP
+
+#include <burst/container/detail/k_ary_inorder_iterator.hpp>
+#include <burst/container/detail/thread_group.hpp>
+#include <burst/integer/intlog.hpp>
+#include <burst/integer/intpow.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+namespace burst
+{
+    namespace detail
+    {
+        inline std::size_t perfect_tree_size (std::size_t arity, std::size_t height)
+        {
+            return intpow(arity, height) - 1;
+        }
+
+        inline std::size_t perfect_tree_height (std::size_t arity, std::size_t size)
+        {
+            return intlog(size, arity) + 1;
+        }
+
+        inline std::size_t perfect_tree_child_index (std::size_t arity, std::size_t parent_index, std::size_t child_number)
+        {
+            return parent_index * arity + (child_number + 1) * (arity - 1);
+        }
+
+        //!     Номер элемента дерева, стоящего на заданном месте в порядке возрастания.
+        /*!
+                Спускается от корня к нужному узлу. Для каждого элемента текущего узла количество
+            меньших элементов ветки однозначно определяется размером и высотой ветки, поскольку
+            все уровни дерева, кроме последнего, заполнены, а последний прибит к левому краю.
+            Поэтому на каждом уровне можно сразу сказать, лежит ли искомый элемент в узле или в
+            каком из поддеревьев.
+
+                Асимптотика.
+
+            Время: O(k log_k(N)).
+            Память: O(1).
+         */
+        inline std::size_t k_ary_tree_index_of_rank (std::size_t size, std::size_t arity, std::size_t rank)
+        {
+            BOOST_ASSERT(rank < size);
+
+            std::size_t node_index = 0;
+            std::size_t height = perfect_tree_height(arity, size);
+            while (height > 1)
+            {
+                const std::size_t min_subtree_elements = perfect_tree_size(arity, height - 2);
+                const std::size_t max_subtree_elements = perfect_tree_size(arity, height - 1);
+                const std::size_t elements_in_last_row = size - perfect_tree_size(arity, height - 1);
+
+                // Количество элементов ветки, меньших i-го элемента узла.
+                const auto smaller_elements =
+                    [&] (std::size_t i)
+                    {
+                        return i + std::min
+                        (
+                            (i + 1) * min_subtree_elements + elements_in_last_row,
+                            (i + 1) * max_subtree_elements
+                        );
+                    };
+
+                std::size_t child_number = 0;
+                while (smaller_elements(child_number) < rank)
+                {
+                    ++child_number;
+                }
+                if (smaller_elements(child_number) == rank)
+                {
+                    return node_index + child_number;
+                }
+
+                const auto subtree_first_rank = child_number == 0 ? 0 : smaller_elements(child_number - 1) + 1;
+                rank -= subtree_first_rank;
+                size = smaller_elements(child_number) - subtree_first_rank;
+                node_index = perfect_tree_child_index(arity, node_index, child_number);
+                --height;
+            }
+
+            return node_index + rank;
+        }
+
+        //!     Расстановка части элементов по своим местам.
+        /*!
+                Находит место элемента ранга first_rank и дальше обходит дерево в порядке
+            возрастания, записывая на очередное место очередной элемент исходного диапазона, пока
+            не будут расставлены все элементы с рангами из [first_rank, last_rank).
+         */
+        template <typename RandomAccessRange, typename RandomAccessIterator>
+        void
+            arrange_k_ary_search_tree_part
+            (
+                const RandomAccessRange & range,
+                std::size_t arity,
+                RandomAccessIterator tree,
+                std::size_t first_rank,
+                std::size_t last_rank
+            )
+        {
+            using range_difference_type = typename RandomAccessRange::difference_type;
+
+            if (first_rank == last_rank)
+            {
+                return;
+            }
+
+            const auto size = static_cast<std::size_t>(range.size());
+            const auto node_size = arity - 1;
+            const auto first_index = k_ary_tree_index_of_rank(size, arity, first_rank);
+
+            auto position =
+                k_ary_inorder_iterator<RandomAccessIterator>
+                (
+                    tree,
+                    size,
+                    arity,
+                    node_size,
+                    first_index / node_size,
+                    first_index % node_size
+                );
+            auto source = std::next(range.begin(), static_cast<range_difference_type>(first_rank));
+            for (auto rank = first_rank; rank < last_rank; ++rank, ++position, ++source)
+            {
+                *position = *source;
+            }
+        }
+
+        //!     Расстановка элементов по своим местам.
+        /*!
+                Принимает упорядоченный диапазон уникальных элементов, местность дерева и итератор
+            на начало массива, в который нужно записать дерево. В массиве должно быть место как
+            минимум для |range| элементов.
+                Обходит дерево в порядке возрастания и расставляет по местам элементы исходной
+            последовательности.
+
+                Асимптотика.
+
+            Время: O(N), N — количество элементов в дереве.
+            Память: O(1).
+         */
+        template <typename RandomAccessRange, typename RandomAccessIterator>
+        void arrange_k_ary_search_tree (const RandomAccessRange & range, std::size_t arity, RandomAccessIterator tree)
+        {
+            arrange_k_ary_search_tree_part(range, arity, tree, 0, static_cast<std::size_t>(range.size()));
+        }
+
+        //!     Параллельная расстановка элементов по своим местам.
+        /*!
+                Делит исходный диапазон на thread_count частей примерно одинакового размера, и
+            каждая часть расставляется в отдельном потоке. Место первого элемента каждой части
+            вычисляется по его рангу, так что потокам не нужно ничего знать друг о друге: каждый
+            элемент попадает в своё место в массиве, и ни одно место не пишется дважды.
+                Если система не может создать очередной поток, оставшиеся части расставляются в
+            вызывающем потоке. Копирование элементов не должно бросать исключений.
+
+                Асимптотика.
+
+            Время: O(N / P + P k log_k(N)), P — количество потоков.
+            Память: O(P).
+         */
+        template <typename RandomAccessRange, typename RandomAccessIterator>
+        void
+            arrange_k_ary_search_tree
+            (
+                const RandomAccessRange & range,
+                std::size_t arity,
+                RandomAccessIterator tree,
+                std::size_t thread_count
+            )
+        {
+            const auto size = static_cast<std::size_t>(range.size());
+            thread_count = std::max<std::size_t>(1, std::min(thread_count, size));
+            const auto part_size = (size + thread_count - 1) / thread_count;
+
+            const auto arrange_part =
+                [& range, arity, tree, part_size, size] (std::size_t part)
+                {
+                    const auto first_rank = std::min(part * part_size, size);
+                    const auto last_rank = std::min(first_rank + part_size, size);
+                    arrange_k_ary_search_tree_part(range, arity, tree, first_rank, last_rank);
+                };
+
+            thread_group threads(thread_count - 1);
+            std::size_t part = 1;
+            while (part < thread_count && threads.try_spawn([& arrange_part, part] {arrange_part(part);}))
+            {
+                ++part;
+            }
+
+            arrange_part(0);
+            for (; part < thread_count; ++part)
+            {
+                arrange_part(part);
+            }
+
+            threads.join();
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_K_ARY_SEARCH_TREE_HPP
@@ -0,0 +1,130 @@
+#ifndef BURST_CONTAINER_DETAIL_K_ARY_SLOT_ITERATOR_HPP
+#define BURST_CONTAINER_DETAIL_K_ARY_SLOT_ITERATOR_HPP
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Итератор по элементам k-местного дерева в порядке их номеров.
+        /*!
+                Элементы дерева пронумерованы подряд, узел за узлом, но в хранилище между узлами
+            могут быть промежутки (см. container::aligned_nodes). Итератор проходит по номерам
+            элементов, а место элемента в хранилище вычисляет с помощью политики хранения узлов,
+            поэтому промежутки пропускаются.
+         */
+        template <typename RandomAccessIterator, typename NodeStorage>
+        class k_ary_slot_iterator:
+            public boost::iterator_facade
+            <
+                k_ary_slot_iterator<RandomAccessIterator, NodeStorage>,
+                std::remove_reference_t<typename std::iterator_traits<RandomAccessIterator>::reference>,
+                boost::random_access_traversal_tag,
+                typename std::iterator_traits<RandomAccessIterator>::reference,
+                typename std::iterator_traits<RandomAccessIterator>::difference_type
+            >
+        {
+        private:
+            using base_iterator_type = RandomAccessIterator;
+            using base_type =
+                boost::iterator_facade
+                <
+                    k_ary_slot_iterator,
+                    std::remove_reference_t<typename std::iterator_traits<base_iterator_type>::reference>,
+                    boost::random_access_traversal_tag,
+                    typename std::iterator_traits<base_iterator_type>::reference,
+                    typename std::iterator_traits<base_iterator_type>::difference_type
+                >;
+
+            template <typename, typename>
+            friend class k_ary_slot_iterator;
+
+        public:
+            k_ary_slot_iterator
+                    (
+                        base_iterator_type nodes,
+                        std::size_t index,
+                        std::size_t node_size,
+                        std::size_t node_stride
+                    ):
+                m_nodes(nodes),
+                m_index(index),
+                m_node_size(node_size),
+                m_node_stride(node_stride)
+            {
+            }
+
+            template
+            <
+                typename OtherIterator,
+                typename = std::enable_if_t<std::is_convertible<OtherIterator, base_iterator_type>::value>
+            >
+            k_ary_slot_iterator (const k_ary_slot_iterator<OtherIterator, NodeStorage> & that):
+                m_nodes(that.m_nodes),
+                m_index(that.m_index),
+                m_node_size(that.m_node_size),
+                m_node_stride(that.m_node_stride)
+            {
+            }
+
+            k_ary_slot_iterator () = default;
+
+            //!     Номер элемента в дереве.
+            std::size_t index () const
+            {
+                return m_index;
+            }
+
+        private:
+            friend class boost::iterator_core_access;
+
+            typename base_type::reference dereference () const
+            {
+                const auto slot = NodeStorage::slot(m_index, m_node_size, m_node_stride);
+                return m_nodes[static_cast<typename base_type::difference_type>(slot)];
+            }
+
+            template <typename OtherIterator>
+            bool equal (const k_ary_slot_iterator<OtherIterator, NodeStorage> & that) const
+            {
+                return this->m_index == that.m_index;
+            }
+
+            void increment ()
+            {
+                ++m_index;
+            }
+
+            void decrement ()
+            {
+                --m_index;
+            }
+
+            void advance (typename base_type::difference_type n)
+            {
+                m_index = static_cast<std::size_t>(static_cast<typename base_type::difference_type>(m_index) + n);
+            }
+
+            template <typename OtherIterator>
+            typename base_type::difference_type
+                distance_to (const k_ary_slot_iterator<OtherIterator, NodeStorage> & that) const
+            {
+                using difference_type = typename base_type::difference_type;
+                return static_cast<difference_type>(that.m_index) - static_cast<difference_type>(this->m_index);
+            }
+
+        private:
+            base_iterator_type m_nodes;
+            std::size_t m_index;
+            std::size_t m_node_size;
+            std::size_t m_node_stride;
+        };
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_K_ARY_SLOT_ITERATOR_HPP
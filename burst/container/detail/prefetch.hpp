@@ -0,0 +1,46 @@
+#ifndef BURST_CONTAINER_DETAIL_PREFETCH_HPP
+#define BURST_CONTAINER_DETAIL_PREFETCH_HPP
+
+#include <cstddef>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Размер строки кэша, на который рассчитана предвыборка.
+        const std::size_t prefetch_line_size = 64;
+
+        //!     Подсказать процессору, что скоро понадобится память по заданному адресу.
+        /*!
+                Предвыборка не меняет семантику программы, поэтому там, где компилятор не
+            поддерживает её явно, функция ничего не делает.
+         */
+        inline void prefetch (const void * address)
+        {
+#if defined(__GNUC__)
+            __builtin_prefetch(address);
+#else
+            static_cast<void>(address);
+#endif
+        }
+
+        //!     Подсказать, что скоро понадобится блок памяти заданного размера.
+        /*!
+                Запрашивает каждую строку кэша, которую затрагивает блок [address, address + size).
+         */
+        inline void prefetch (const void * address, std::size_t size)
+        {
+            const auto first = static_cast<const char *>(address);
+            for (std::size_t offset = 0; offset < size; offset += prefetch_line_size)
+            {
+                prefetch(first + offset);
+            }
+            if (size > 0)
+            {
+                prefetch(first + size - 1);
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_PREFETCH_HPP
@@ -0,0 +1,78 @@
+#ifndef BURST_CONTAINER_DETAIL_THREAD_GROUP_HPP
+#define BURST_CONTAINER_DETAIL_THREAD_GROUP_HPP
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Группа потоков, которые присоединяются при разрушении группы.
+        /*!
+                Если после запуска части потоков бросается исключение (не удалось создать
+            очередной поток, не хватило памяти в вызывающем потоке и т.п.), то завершения уже
+            запущенных потоков дождётся деструктор группы. Иначе они были бы разрушены
+            присоединяемыми, что привело бы к вызову std::terminate.
+                Место под все потоки резервируется заранее, поэтому запуск потока не
+            перевыделяет память.
+         */
+        class thread_group
+        {
+        public:
+            explicit thread_group (std::size_t capacity)
+            {
+                m_threads.reserve(capacity);
+            }
+
+            thread_group (const thread_group &) = delete;
+            thread_group & operator = (const thread_group &) = delete;
+
+            ~thread_group ()
+            {
+                join();
+            }
+
+            //!     Запустить поток.
+            /*!
+                    Возвращает false, если система не смогла создать поток. В этом случае
+                функция не вызывается, и её работу можно выполнить в вызывающем потоке.
+             */
+            template <typename Function>
+            bool try_spawn (const Function & function)
+            {
+                BOOST_ASSERT(m_threads.size() < m_threads.capacity());
+                try
+                {
+                    m_threads.emplace_back(function);
+                    return true;
+                }
+                catch (const std::system_error &)
+                {
+                    return false;
+                }
+            }
+
+            //!     Дождаться завершения всех запущенных потоков.
+            void join ()
+            {
+                for (auto & thread: m_threads)
+                {
+                    if (thread.joinable())
+                    {
+                        thread.join();
+                    }
+                }
+            }
+
+        private:
+            std::vector<std::thread> m_threads;
+        };
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_CONTAINER_DETAIL_THREAD_GROUP_HPP
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -29,6 +30,9 @@ namespace burst
         за другом. Это снимает лишний уровень косвенности при обращении к ним по сравнению с тем,
         если бы это был, например, массив указателей на базовый класс, как это обычно делается для
         хранения в массиве классов из одной иерархии.
+            3. Если все объекты кортежа тривиально копируемы, то при копировании кортежа и
+        перевыделении памяти буфер переносится целиком одним вызовом std::memcpy, без обращения к
+        менеджерам отдельных объектов, а разрушение объектов не требует никаких действий.
      */
     class dynamic_tuple
     {
@@ -42,7 +46,7 @@ namespace burst
         template <typename ... Types>
         explicit dynamic_tuple (Types ... objects):
             m_capacity(sum({sizeof(Types) + alignof(Types)...})),
-            m_data(std::make_unique<std::int8_t[]>(m_capacity))
+            m_data(allocate(m_capacity))
         {
             try
             {
@@ -57,7 +61,17 @@ namespace burst
 
         dynamic_tuple () = default;
 
-        dynamic_tuple (dynamic_tuple &&) = default;
+        //!     Перемещение кортежа.
+        /*!
+                Перемещённый кортеж становится пустым, как созданный конструктором по умолчанию.
+            Перемещение по умолчанию оставило бы в нём прежние объём и вместимость при нулевом
+            буфере, и побайтовое копирование такого кортежа обратилось бы к нулевому указателю.
+         */
+        dynamic_tuple (dynamic_tuple && that) noexcept:
+            dynamic_tuple()
+        {
+            this->swap(that);
+        }
 
         dynamic_tuple & operator = (dynamic_tuple && that)
         {
@@ -67,11 +81,19 @@ namespace burst
 
         dynamic_tuple (const dynamic_tuple & that):
             m_capacity(that.m_capacity),
-            m_data(std::make_unique<std::int8_t[]>(m_capacity)),
+            m_data(allocate(m_capacity)),
             m_objects(that.m_objects),
-            m_volume(that.m_volume)
+            m_volume(that.m_volume),
+            m_nontrivial_count(that.m_nontrivial_count)
         {
-            management::copy(m_objects.begin(), m_objects.end(), that.data(), this->data());
+            if (is_trivially_copyable())
+            {
+                copy_bytes(that.data(), this->data());
+            }
+            else
+            {
+                management::copy(m_objects.begin(), m_objects.end(), that.data(), this->data());
+            }
         }
 
         dynamic_tuple & operator = (const dynamic_tuple & that)
@@ -90,6 +112,7 @@ namespace burst
             this->m_data.swap(that.m_data);
             this->m_objects.swap(that.m_objects);
             std::swap(this->m_volume, that.m_volume);
+            std::swap(this->m_nontrivial_count, that.m_nontrivial_count);
         }
 
         //!     Обеспечить необходимую вместительность контейнера.
@@ -161,7 +184,11 @@ namespace burst
          */
         void pop_back ()
         {
-            management::destroy(m_objects.back(), data());
+            if (not management::is_trivially_copyable(m_objects.back()))
+            {
+                management::destroy(m_objects.back(), data());
+                --m_nontrivial_count;
+            }
             m_objects.pop_back();
 
             if (not m_objects.empty())
@@ -189,6 +216,7 @@ namespace burst
             destroy_all();
             m_objects.clear();
             m_volume = 0;
+            m_nontrivial_count = 0;
         }
 
         //!     Доступ к неизменяемому элементу по индексу.
@@ -315,13 +343,49 @@ namespace burst
         void reallocate (std::size_t new_capacity)
         {
             assert(new_capacity >= m_volume);
-            auto new_data = std::make_unique<std::int8_t[]>(new_capacity);
-            m_capacity = new_capacity;
+            auto new_data = allocate(new_capacity);
 
-            management::move(m_objects.begin(), m_objects.end(), data(), new_data.get());
+            if (is_trivially_copyable())
+            {
+                copy_bytes(data(), new_data.get());
+            }
+            else
+            {
+                management::move(m_objects.begin(), m_objects.end(), data(), new_data.get());
+            }
+            m_capacity = new_capacity;
             std::swap(m_data, new_data);
         }
 
+        //!     Выделить неинициализированный буфер.
+        /*!
+                В отличие от std::make_unique, не заполняет буфер нулями: всё, что в нём окажется,
+            будет записано туда при создании, копировании или перемещении объектов.
+         */
+        static std::unique_ptr<std::int8_t[]> allocate (std::size_t capacity)
+        {
+            return std::unique_ptr<std::int8_t[]>(new std::int8_t[capacity]);
+        }
+
+        //!     Все ли объекты кортежа тривиально копируемы.
+        bool is_trivially_copyable () const
+        {
+            return m_nontrivial_count == 0;
+        }
+
+        //!     Побайтово скопировать все объекты кортежа.
+        /*!
+                Применимо только тогда, когда все объекты кортежа тривиально копируемы. Тогда
+            копия объекта создаётся копированием его байтов, а разрушать исходный объект не нужно.
+         */
+        void copy_bytes (const std::int8_t * source, std::int8_t * destination) const
+        {
+            if (m_volume > 0)
+            {
+                std::memcpy(destination, source, m_volume);
+            }
+        }
+
         std::int8_t * data ()
         {
             return m_data.get();
@@ -410,11 +474,18 @@ namespace burst
             const auto new_offset = static_cast<std::size_t>(creation_place - data());
             m_objects.push_back(management::make_object_info<raw_type>(new_offset));
             m_volume = new_offset + sizeof(raw_type);
+            if (not std::is_trivially_copyable<raw_type>::value)
+            {
+                ++m_nontrivial_count;
+            }
         }
 
         void destroy_all ()
         {
-            management::destroy(m_objects.begin(), m_objects.end(), data());
+            if (not is_trivially_copyable())
+            {
+                management::destroy(m_objects.begin(), m_objects.end(), data());
+            }
         }
 
         //!     Коэффициент роста вместимости контейнера.
@@ -427,6 +498,8 @@ namespace burst
 
         object_info_container_type m_objects;
         std::size_t m_volume = 0;
+        //!     Количество объектов, которые нельзя копировать побайтово.
+        std::size_t m_nontrivial_count = 0;
     };
 
     inline void swap (dynamic_tuple & left, dynamic_tuple & right)
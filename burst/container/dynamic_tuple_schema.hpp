@@ -0,0 +1,125 @@
+#ifndef BURST_CONTAINER_DYNAMIC_TUPLE_SCHEMA_HPP
+#define BURST_CONTAINER_DYNAMIC_TUPLE_SCHEMA_HPP
+
+#include <burst/container/detail/dynamic_tuple_management.hpp>
+#include <burst/variadic.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace burst
+{
+    //!     Схема динамического кортежа.
+    /*!
+            Описание набора разнородных объектов, которое вычисляется один раз и разделяется
+        многими кортежами одинакового состава (см. schema_tuple): типы объектов, их выровненные
+        отступы от начала хранилища, суммарный объём и наибольшее выравнивание, а также признак
+        того, что все объекты тривиально копируемы.
+            Отступы считаются от начала хранилища, выровненного так же, как выравниваются блоки,
+        выделяемые оператором new, поэтому выравнивание любого типа схемы не должно превышать
+        alignof(std::max_align_t).
+            Схема может строиться и во время исполнения, по одному типу за раз.
+     */
+    class dynamic_tuple_schema
+    {
+    private:
+        using object_info_container_type = std::vector<management::object_info_t>;
+
+    public:
+        using size_type = typename object_info_container_type::size_type;
+
+    public:
+        //!     Добавить в схему объект заданного типа.
+        /*!
+                Новый объект располагается сразу за последним объектом схемы с учётом своего
+            выравнивания.
+
+                Сложность: O(1) в среднем.
+         */
+        template <typename T>
+        void push_back ()
+        {
+            static_assert(alignof(T) <= alignof(std::max_align_t), "Выравнивание типа слишком велико для схемы.");
+
+            const auto offset = (m_volume + alignof(T) - 1) / alignof(T) * alignof(T);
+            m_objects.push_back(management::make_object_info<T>(offset));
+            m_volume = offset + sizeof(T);
+            m_alignment = std::max(m_alignment, alignof(T));
+            m_trivially_copyable = m_trivially_copyable && std::is_trivially_copyable<T>::value;
+        }
+
+        //!     Количество объектов в схеме.
+        size_type size () const
+        {
+            return m_objects.size();
+        }
+
+        bool empty () const
+        {
+            return m_objects.empty();
+        }
+
+        //!     Отступ объекта с заданным индексом от начала хранилища.
+        std::size_t offset (size_type index) const
+        {
+            return m_objects[index].offset;
+        }
+
+        //!     Суммарный объём объектов схемы вместе с промежутками для выравнивания.
+        std::size_t volume () const
+        {
+            return m_volume;
+        }
+
+        //!     Наибольшее выравнивание среди типов схемы.
+        std::size_t alignment () const
+        {
+            return m_alignment;
+        }
+
+        //!     Все ли объекты схемы тривиально копируемы.
+        bool is_trivially_copyable () const
+        {
+            return m_trivially_copyable;
+        }
+
+        //!     Информация о типе объекта по индексу.
+        const std::type_info & type (size_type index) const
+        {
+            return management::type(m_objects[index]);
+        }
+
+        //!     Является ли объект с заданным индексом объектом типа T.
+        template <typename T>
+        bool holds (size_type index) const
+        {
+            return m_objects[index].manage == &management::manage<T>;
+        }
+
+        const object_info_container_type & objects () const
+        {
+            return m_objects;
+        }
+
+    private:
+        object_info_container_type m_objects;
+        std::size_t m_volume = 0;
+        std::size_t m_alignment = 1;
+        bool m_trivially_copyable = true;
+    };
+
+    //!     Создать разделяемую схему из заданного набора типов.
+    template <typename ... Types>
+    std::shared_ptr<const dynamic_tuple_schema> make_dynamic_tuple_schema ()
+    {
+        auto schema = std::make_shared<dynamic_tuple_schema>();
+        BURST_EXPAND_VARIADIC(schema->push_back<Types>());
+        return schema;
+    }
+} // namespace burst
+
+#endif // BURST_CONTAINER_DYNAMIC_TUPLE_SCHEMA_HPP
@@ -0,0 +1,156 @@
+#ifndef BURST_CONTAINER_EYTZINGER_LAYOUT_HPP
+#define BURST_CONTAINER_EYTZINGER_LAYOUT_HPP
+
+#include <burst/container/aligned_allocator.hpp>
+#include <burst/container/detail/prefetch.hpp>
+#include <burst/integer/intlog2.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Количество единичных битов в конце числа.
+        inline std::size_t trailing_ones (std::size_t number)
+        {
+#if defined(__GNUC__)
+            return ~number == 0
+                ? sizeof(number) * 8
+                : static_cast<std::size_t>(__builtin_ctzll(static_cast<unsigned long long>(~number)));
+#else
+            std::size_t count = 0;
+            while ((number & 1) != 0)
+            {
+                number >>= 1;
+                ++count;
+            }
+            return count;
+#endif
+        }
+    } // namespace detail
+
+    namespace container
+    {
+        //!     Раскладка Эйтцингера.
+        /*!
+                Элементы хранятся в порядке обхода двоичного дерева поиска в ширину, как в
+            двоичной пирамиде: у элемента с номером i (нумерация с единицы) дети имеют номера 2i и
+            2i + 1.
+                Спуск по дереву не содержит ветвлений: номер следующего элемента вычисляется как
+            2i + [a_i < x]. Кроме того, все потомки элемента на несколько уровней вниз лежат в
+            массиве подряд, поэтому их можно запросить из памяти заранее, пока идёт сравнение на
+            текущем уровне. Это прячет задержку памяти на больших массивах.
+                Хорошо работает на множествах любого размера, особенно на не помещающихся в кэш.
+         */
+        struct eytzinger_layout
+        {
+            template <typename Value, typename Compare>
+            class tree
+            {
+            private:
+                using value_container_type = std::vector<Value, aligned_allocator<Value, detail::prefetch_line_size>>;
+
+            public:
+                using const_iterator = typename value_container_type::const_iterator;
+
+                tree ():
+                    m_values(1)
+                {
+                }
+
+                //!     Построение из упорядоченного набора уникальных элементов.
+                template <typename RandomAccessRange>
+                tree (const RandomAccessRange & range, const Compare & compare):
+                    m_values(static_cast<std::size_t>(range.size()) + 1),
+                    m_compare(compare)
+                {
+                    auto next = range.begin();
+                    fill(1, next);
+                    BOOST_ASSERT(next == range.end());
+                }
+
+                const_iterator find (const Value & value) const
+                {
+                    const auto values = m_values.data();
+                    const auto size = m_values.size() - 1;
+
+                    std::size_t index = 1;
+                    while (index <= size)
+                    {
+                        detail::prefetch(values + std::min(index * elements_per_line, size));
+                        index = 2 * index + static_cast<std::size_t>(m_compare(values[index], value));
+                    }
+                    // Путь поиска повернул налево последний раз на нижней грани. Все повороты
+                    // направо после него — это единичные биты в конце номера.
+                    index >>= detail::trailing_ones(index) + 1;
+
+                    if (index != 0 && not m_compare(value, values[index]))
+                    {
+                        return m_values.begin() + static_cast<std::ptrdiff_t>(index);
+                    }
+                    else
+                    {
+                        return end();
+                    }
+                }
+
+                //!     Начало массива.
+                /*!
+                        Элементы идут в порядке обхода дерева в ширину, то есть неупорядочены.
+                 */
+                const_iterator begin () const
+                {
+                    return m_values.begin() + 1;
+                }
+
+                const_iterator end () const
+                {
+                    return m_values.end();
+                }
+
+                std::size_t size () const
+                {
+                    return m_values.size() - 1;
+                }
+
+            private:
+                //!     Заполнение поддерева с корнем в заданном элементе.
+                /*!
+                        Обходит поддерево в порядке возрастания и записывает в очередной элемент
+                    очередное значение из упорядоченного набора.
+                 */
+                template <typename Iterator>
+                void fill (std::size_t index, Iterator & next)
+                {
+                    if (index < m_values.size())
+                    {
+                        fill(2 * index, next);
+                        m_values[index] = *next;
+                        ++next;
+                        fill(2 * index + 1, next);
+                    }
+                }
+
+            private:
+                // Количество элементов, занимающих строку кэша, округлённое вниз до степени двойки.
+                // Потомки элемента i на log2(L) уровней вниз начинаются с номера i * L.
+                static const std::size_t elements_per_line =
+                    std::size_t{1} << intlog2(std::max<std::size_t>(1, detail::prefetch_line_size / sizeof(Value)));
+
+            private:
+                value_container_type m_values;
+                Compare m_compare;
+            };
+        };
+
+        template <typename Value, typename Compare>
+        const std::size_t eytzinger_layout::tree<Value, Compare>::elements_per_line;
+    } // namespace container
+} // namespace burst
+
+#endif // BURST_CONTAINER_EYTZINGER_LAYOUT_HPP
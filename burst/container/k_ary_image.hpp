@@ -0,0 +1,404 @@
+#ifndef BURST_CONTAINER_K_ARY_IMAGE_HPP
+#define BURST_CONTAINER_K_ARY_IMAGE_HPP
+
+#include <burst/container/k_ary_node_storage.hpp>
+#include <burst/container/k_ary_search_set.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Заголовок образа k-местного дерева.
+        /*!
+                Образ — это заголовок, за которым с позиции k_ary_image_values_offset лежит
+            хранилище узлов дерева в том виде, в котором оно находится в памяти. Числа записываются
+            в порядке байтов той машины, на которой образ создан.
+         */
+        struct k_ary_image_header
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t value_size;
+            std::uint64_t arity;
+            std::uint64_t size;
+            std::uint64_t node_stride;
+            std::uint64_t value_count;
+        };
+
+        const char k_ary_image_magic[8] = {'b', 'u', 'r', 's', 't', 'k', 'a', 's'};
+        const std::uint32_t k_ary_image_version = 1;
+
+        //!     Смещение хранилища узлов от начала образа.
+        /*!
+                Отображение файла в память начинается с границы страницы, поэтому хранилище,
+            начинающееся с этого смещения, выровнено по строке кэша, и выровненные узлы
+            (container::cache_aligned_nodes) остаются выровненными.
+         */
+        const std::size_t k_ary_image_values_offset = 64;
+
+        static_assert(sizeof(k_ary_image_header) <= k_ary_image_values_offset, "Заголовок образа не помещается перед хранилищем.");
+    } // namespace detail
+
+    namespace container
+    {
+        //!     Образ k-местного дерева, отображённый в память.
+        /*!
+                Открывает файл, созданный функцией container::write_image, и отображает его в
+            память только для чтения. Данные не копируются: страницы файла подгружаются по мере
+            обращения к ним, а несколько процессов, открывших один и тот же образ, разделяют одну
+            копию в страничном кэше.
+                Отображение живёт, пока жив хотя бы один объект, который на него ссылается: сам образ,
+            его копии или построенные по нему множества.
+         */
+        class k_ary_image
+        {
+        public:
+            explicit k_ary_image (const std::string & path)
+            {
+                const auto file = ::open(path.c_str(), O_RDONLY);
+                if (file == -1)
+                {
+                    throw std::system_error(errno, std::generic_category(), "Не удалось открыть образ " + path);
+                }
+
+                struct stat status;
+                if (::fstat(file, &status) == -1)
+                {
+                    const auto error = errno;
+                    ::close(file);
+                    throw std::system_error(error, std::generic_category(), "Не удалось открыть образ " + path);
+                }
+                const auto length = static_cast<std::size_t>(status.st_size);
+                if (length < detail::k_ary_image_values_offset)
+                {
+                    ::close(file);
+                    throw std::runtime_error("Файл " + path + " слишком мал для образа k-местного дерева.");
+                }
+
+                const auto address = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, file, 0);
+                const auto error = errno;
+                ::close(file);
+                if (address == MAP_FAILED)
+                {
+                    throw std::system_error(error, std::generic_category(), "Не удалось отобразить образ " + path);
+                }
+
+                m_mapping.reset(address, [length] (void * mapping) { ::munmap(mapping, length); });
+                m_header = static_cast<const detail::k_ary_image_header *>(address);
+
+                if (std::memcmp(m_header->magic, detail::k_ary_image_magic, sizeof(m_header->magic)) != 0 ||
+                    m_header->version != detail::k_ary_image_version)
+                {
+                    throw std::runtime_error("Файл " + path + " не является образом k-местного дерева.");
+                }
+                if (m_header->value_size == 0 ||
+                    m_header->value_count > (length - detail::k_ary_image_values_offset) / m_header->value_size)
+                {
+                    throw std::runtime_error("Образ " + path + " повреждён.");
+                }
+            }
+
+            std::size_t arity () const
+            {
+                return static_cast<std::size_t>(m_header->arity);
+            }
+
+            std::size_t size () const
+            {
+                return static_cast<std::size_t>(m_header->size);
+            }
+
+            std::size_t node_stride () const
+            {
+                return static_cast<std::size_t>(m_header->node_stride);
+            }
+
+            std::size_t value_size () const
+            {
+                return m_header->value_size;
+            }
+
+            //!     Количество элементов хранилища, включая промежутки между узлами.
+            std::size_t value_count () const
+            {
+                return static_cast<std::size_t>(m_header->value_count);
+            }
+
+            //!     Начало хранилища узлов.
+            const void * values () const
+            {
+                return static_cast<const char *>(m_mapping.get()) + detail::k_ary_image_values_offset;
+            }
+
+            //!     Владение отображением.
+            const std::shared_ptr<void> & mapping () const
+            {
+                return m_mapping;
+            }
+
+        private:
+            std::shared_ptr<void> m_mapping;
+            const detail::k_ary_image_header * m_header;
+        };
+
+        //!     Хранилище, не владеющее элементами.
+        /*!
+                Вид на массив элементов, лежащий в отображённом в память образе. Элементы доступны
+            только для чтения, а само хранилище держит отображение, пока оно нужно.
+         */
+        template <typename Value>
+        class mapped_buffer
+        {
+        public:
+            using value_type = Value;
+            using iterator = const value_type *;
+            using const_iterator = const value_type *;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+
+            mapped_buffer ():
+                m_values(nullptr),
+                m_size(0)
+            {
+            }
+
+            explicit mapped_buffer (const k_ary_image & image):
+                m_mapping(image.mapping()),
+                m_values(static_cast<const value_type *>(image.values())),
+                m_size(image.value_count())
+            {
+            }
+
+            const value_type * data () const
+            {
+                return m_values;
+            }
+
+            const_iterator begin () const
+            {
+                return m_values;
+            }
+
+            const_iterator end () const
+            {
+                return m_values + m_size;
+            }
+
+            const_iterator cbegin () const
+            {
+                return begin();
+            }
+
+            const_iterator cend () const
+            {
+                return end();
+            }
+
+            size_type size () const
+            {
+                return m_size;
+            }
+
+            const value_type & operator [] (size_type index) const
+            {
+                return m_values[index];
+            }
+
+        private:
+            std::shared_ptr<void> m_mapping;
+            const value_type * m_values;
+            size_type m_size;
+        };
+
+        //!     Хранение узлов в отображённом в память образе.
+        /*!
+                Политика хранения, не владеющая узлами. Узлы расположены так же, как в политике
+            NodeStorage, с которой образ был записан, но лежат не в собственной памяти контейнера,
+            а в образе, открытом только для чтения. Построить множество с такой политикой можно
+            только из образа.
+
+            \tparam NodeStorage
+                Политика, с которой был записан образ.
+         */
+        template <typename NodeStorage = packed_nodes>
+        struct mapped_nodes
+        {
+            template <typename Value>
+            using buffer_type = mapped_buffer<Value>;
+
+            template <typename Value>
+            static std::size_t node_stride (std::size_t node_size)
+            {
+                return NodeStorage::template node_stride<Value>(node_size);
+            }
+
+            static std::size_t slot (std::size_t index, std::size_t node_size, std::size_t node_stride)
+            {
+                return NodeStorage::slot(index, node_size, node_stride);
+            }
+        };
+    } // namespace container
+
+    namespace detail
+    {
+        //!     Хранилище узлов, построенное по образу.
+        /*!
+                Собственное хранилище получает копию узлов образа, а хранилище, не владеющее
+            элементами, — вид на них.
+         */
+        template <typename Buffer>
+        struct buffer_from_image
+        {
+            static Buffer apply (const container::k_ary_image & image)
+            {
+                using value_type = typename Buffer::value_type;
+                const auto values = static_cast<const value_type *>(image.values());
+                return Buffer(values, values + image.value_count());
+            }
+        };
+
+        template <typename Value>
+        struct buffer_from_image<container::mapped_buffer<Value>>
+        {
+            static container::mapped_buffer<Value> apply (const container::k_ary_image & image)
+            {
+                return container::mapped_buffer<Value>(image);
+            }
+        };
+
+        //!     Доступ к внутреннему устройству множества для записи и чтения образов.
+        struct k_ary_image_access
+        {
+            template <typename Value, typename Compare, typename NodeStorage>
+            static void write (const k_ary_search_set<Value, Compare, NodeStorage> & set, std::ostream & stream)
+            {
+                static_assert(std::is_trivially_copyable<Value>::value, "Элементы образа должны быть тривиально копируемыми.");
+
+                k_ary_image_header header{};
+                std::copy(std::begin(k_ary_image_magic), std::end(k_ary_image_magic), header.magic);
+                header.version = k_ary_image_version;
+                header.value_size = sizeof(Value);
+                header.arity = set.m_arity;
+                header.size = set.m_size;
+                header.node_stride = set.m_node_stride;
+                header.value_count = set.m_values.size();
+
+                const char padding[k_ary_image_values_offset] = {};
+                stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+                stream.write(padding, k_ary_image_values_offset - sizeof(header));
+                stream.write
+                (
+                    reinterpret_cast<const char *>(set.m_values.data()),
+                    static_cast<std::streamsize>(set.m_values.size() * sizeof(Value))
+                );
+            }
+
+            template <typename Set>
+            static Set load (const container::k_ary_image & image, const typename Set::value_compare & compare)
+            {
+                using value_container_type = typename Set::value_container_type;
+                return Set
+                (
+                    buffer_from_image<value_container_type>::apply(validate<Set>(image)),
+                    image.size(),
+                    image.arity(),
+                    image.node_stride(),
+                    compare
+                );
+            }
+
+            template <typename Set>
+            static const container::k_ary_image & validate (const container::k_ary_image & image)
+            {
+                using value_type = typename Set::value_type;
+                using node_storage = typename Set::node_storage;
+                static_assert(std::is_trivially_copyable<value_type>::value, "Элементы образа должны быть тривиально копируемыми.");
+
+                auto valid = image.value_size() == sizeof(value_type);
+                if (image.arity() == 0)
+                {
+                    valid = valid && image.size() == 0 && image.value_count() == 0;
+                }
+                else
+                {
+                    const auto node_size = image.arity() - 1;
+                    const auto node_count = node_size == 0 ? 0 : (image.size() + node_size - 1) / node_size;
+                    valid = valid && node_size > 0 &&
+                        image.node_stride() == node_storage::template node_stride<value_type>(node_size) &&
+                        image.value_count() == node_count * image.node_stride();
+                }
+
+                if (not valid)
+                {
+                    throw std::runtime_error("Образ записан для другого типа элементов или другой политики хранения.");
+                }
+                return image;
+            }
+        };
+    } // namespace detail
+
+    namespace container
+    {
+        //!     Запись образа множества.
+        /*!
+                Записывает в поток заголовок с местностью дерева и размером множества, а за ним —
+            хранилище узлов как есть, байт в байт. Полученный файл можно открыть с помощью
+            container::k_ary_image и построить по нему множество без повторной расстановки
+            элементов.
+                Элементы должны быть тривиально копируемыми.
+
+                Асимптотика.
+
+            Время: O(N).
+            Память: O(1).
+         */
+        template <typename Value, typename Compare, typename NodeStorage>
+        void write_image (const k_ary_search_set<Value, Compare, NodeStorage> & set, std::ostream & stream)
+        {
+            detail::k_ary_image_access::write(set, stream);
+        }
+
+        //!     Создание множества из образа.
+        /*!
+                Принимает образ, записанный функцией write_image, и отношение порядка, с которым
+            было построено записанное множество. Если политика хранения — container::mapped_nodes,
+            то множество не копирует элементы, а работает прямо с отображённым в память образом.
+            Иначе элементы образа копируются в собственное хранилище.
+                Если образ записан для другого типа элементов или другой политики хранения, то
+            бросается исключение std::runtime_error.
+
+                Асимптотика.
+
+            Время: O(1), если хранилище не владеющее, и O(N) иначе.
+            Память: O(1).
+
+            \tparam Set
+                Тип множества — экземпляр k_ary_search_set.
+         */
+        template <typename Set>
+        Set load_image (const k_ary_image & image, const typename Set::value_compare & compare = typename Set::value_compare())
+        {
+            return detail::k_ary_image_access::load<Set>(image, compare);
+        }
+    } // namespace container
+} // namespace burst
+
+#endif // BURST_CONTAINER_K_ARY_IMAGE_HPP
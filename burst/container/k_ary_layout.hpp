@@ -0,0 +1,77 @@
+#ifndef BURST_CONTAINER_K_ARY_LAYOUT_HPP
+#define BURST_CONTAINER_K_ARY_LAYOUT_HPP
+
+#include <burst/container/k_ary_node_storage.hpp>
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+
+#include <cstddef>
+
+namespace burst
+{
+    namespace container
+    {
+        //!     Раскладка k-местного дерева поиска.
+        /*!
+                Та же раскладка, что и в k_ary_search_set: каждый узел содержит (k - 1) элементов,
+            все уровни дерева, кроме последнего, заполнены, а последний прибит к левому краю.
+                Поиск может закончиться во внутреннем узле, и дерево не требует дополнительной
+            памяти. Хорошо работает на множествах, помещающихся в кэш, при узле размером со
+            строку кэша.
+
+            \tparam Arity
+                Местность дерева.
+            \tparam NodeStorage
+                Способ хранения узлов (см. k_ary_node_storage.hpp).
+         */
+        template <std::size_t Arity, typename NodeStorage = packed_nodes>
+        struct k_ary_layout
+        {
+            static_assert(Arity > 1, "Местность дерева должна быть больше единицы.");
+
+            template <typename Value, typename Compare>
+            class tree
+            {
+            private:
+                using set_type = k_ary_search_set<Value, Compare, NodeStorage>;
+
+            public:
+                using const_iterator = typename set_type::const_iterator;
+
+                tree () = default;
+
+                //!     Построение из упорядоченного набора уникальных элементов.
+                template <typename RandomAccessRange>
+                tree (const RandomAccessRange & range, const Compare & compare):
+                    m_set(unique_ordered_tag, range.begin(), range.end(), Arity, compare)
+                {
+                }
+
+                const_iterator find (const Value & value) const
+                {
+                    return m_set.find(value);
+                }
+
+                const_iterator begin () const
+                {
+                    return m_set.begin();
+                }
+
+                const_iterator end () const
+                {
+                    return m_set.end();
+                }
+
+                std::size_t size () const
+                {
+                    return m_set.size();
+                }
+
+            private:
+                set_type m_set;
+            };
+        };
+    } // namespace container
+} // namespace burst
+
+#endif // BURST_CONTAINER_K_ARY_LAYOUT_HPP
@@ -0,0 +1,76 @@
+#ifndef BURST_CONTAINER_K_ARY_NODE_STORAGE_HPP
+#define BURST_CONTAINER_K_ARY_NODE_STORAGE_HPP
+
+#include <burst/container/aligned_allocator.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace burst
+{
+    namespace container
+    {
+        //!     Плотное хранение узлов k-местного дерева.
+        /*!
+                Узлы лежат в массиве вплотную друг к другу, без промежутков. Память расходуется
+            экономно, но узел, как правило, оказывается на стыке двух строк кэша.
+         */
+        struct packed_nodes
+        {
+            template <typename Value>
+            using buffer_type = std::vector<Value>;
+
+            //!     Расстояние между началами соседних узлов, в элементах.
+            template <typename Value>
+            static std::size_t node_stride (std::size_t node_size)
+            {
+                return node_size;
+            }
+
+            //!     Место в массиве, где лежит элемент дерева с заданным номером.
+            static std::size_t slot (std::size_t index, std::size_t /* node_size */, std::size_t /* node_stride */)
+            {
+                return index;
+            }
+        };
+
+        //!     Выровненное хранение узлов k-местного дерева.
+        /*!
+                Массив выровнен на границу Alignment байт, а каждый узел дополнен до размера,
+            кратного Alignment. Поэтому каждый узел начинается с границы строки кэша и занимает
+            минимально возможное количество строк.
+
+            \tparam Alignment
+                Выравнивание в байтах. Должно быть степенью двойки.
+         */
+        template <std::size_t Alignment>
+        struct aligned_nodes
+        {
+            template <typename Value>
+            using buffer_type = std::vector<Value, aligned_allocator<Value, Alignment>>;
+
+            template <typename Value>
+            static std::size_t node_stride (std::size_t node_size)
+            {
+                // Наименьшее количество элементов, занимающее целое число блоков выравнивания.
+                auto step = std::size_t{1};
+                while (step * sizeof(Value) % Alignment != 0)
+                {
+                    ++step;
+                }
+
+                return (node_size + step - 1) / step * step;
+            }
+
+            static std::size_t slot (std::size_t index, std::size_t node_size, std::size_t node_stride)
+            {
+                return index / node_size * node_stride + index % node_size;
+            }
+        };
+
+        //!     Хранение узлов, выровненных по строкам кэша.
+        using cache_aligned_nodes = aligned_nodes<64>;
+    } // namespace container
+} // namespace burst
+
+#endif // BURST_CONTAINER_K_ARY_NODE_STORAGE_HPP
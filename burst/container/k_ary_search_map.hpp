@@ -0,0 +1,294 @@
+#ifndef BURST_CONTAINER_K_ARY_SEARCH_MAP_HPP
+#define BURST_CONTAINER_K_ARY_SEARCH_MAP_HPP
+
+#include <burst/container/k_ary_node_storage.hpp>
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+
+#include <boost/iterator/transform_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    //!     Отображение, основанное на k-местном дереве поиска.
+    /*!
+            Ключи хранятся в k_ary_search_set, а значения — в отдельном массиве, в котором
+        значение ключа лежит на том же месте, что и ключ в раскладке дерева. Поэтому при спуске по
+        дереву в кэш попадают только ключи, и в узел помещается столько же ключей, сколько и в узел
+        множества, а к значению происходит ровно одно обращение — после того, как ключ найден.
+            Повторяющихся ключей нет. Если во входном наборе ключ встречается несколько раз, то
+        остаётся первое из соответствующих ему значений.
+
+        \tparam Key
+            Тип ключей.
+        \tparam Mapped
+            Тип значений.
+        \tparam Compare
+            Отношение порядка на ключах.
+        \tparam NodeStorage
+            Политика хранения узлов дерева ключей (см. k_ary_search_set).
+     */
+    template
+    <
+        typename Key,
+        typename Mapped,
+        typename Compare = std::less<Key>,
+        typename NodeStorage = container::packed_nodes
+    >
+    class k_ary_search_map
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Mapped;
+        using value_type = std::pair<key_type, mapped_type>;
+        using key_compare = Compare;
+        using key_set_type = k_ary_search_set<key_type, key_compare, NodeStorage>;
+        using size_type = typename key_set_type::size_type;
+
+    public:
+        //!     Создание отображения из упорядоченного набора пар, представленного итераторами.
+        /*!
+                Принимает два итератора, которые задают набор пар "ключ-значение", местность дерева,
+            отношение порядка на ключах, а также фиктивный элемент — метку, обозначающую, что
+            входной набор упорядочен по ключам и ключи в нём уникальны.
+
+                Асимптотика.
+
+            Время: O(N), N = |[first, last)|.
+            Память: O(N).
+         */
+        template <typename RandomAccessIterator>
+        k_ary_search_map
+                (
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const key_compare & compare = key_compare()
+                ):
+            m_keys
+            (
+                container::unique_ordered_tag,
+                boost::make_transform_iterator(first, key_of{}),
+                boost::make_transform_iterator(last, key_of{}),
+                arity,
+                compare
+            )
+        {
+            initialize_mapped(first);
+        }
+
+        //!     Создание отображения из набора пар, заданного итераторами.
+        /*!
+                Асимптотика.
+
+            Время:
+                1. O(N), если набор упорядочен по ключам.
+                2. O(N logN), если набор неупорядочен,
+                где N = |[first, last)|.
+            Память: O(N).
+         */
+        template <typename RandomAccessIterator>
+        k_ary_search_map
+                (
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const key_compare & compare = key_compare()
+                ):
+            k_ary_search_map(make_ordered(first, last, compare), arity, compare)
+        {
+        }
+
+        k_ary_search_map
+                (
+                    container::unique_ordered_tag_t,
+                    std::initializer_list<value_type> values,
+                    std::size_t arity = default_arity,
+                    const key_compare & compare = key_compare()
+                ):
+            k_ary_search_map(container::unique_ordered_tag, values.begin(), values.end(), arity, compare)
+        {
+        }
+
+        k_ary_search_map
+                (
+                    std::initializer_list<value_type> values,
+                    std::size_t arity = default_arity,
+                    const key_compare & compare = key_compare()
+                ):
+            k_ary_search_map(values.begin(), values.end(), arity, compare)
+        {
+        }
+
+        k_ary_search_map () = default;
+
+    public:
+        //!     Поиск значения по ключу.
+        /*!
+                Возвращает указатель на значение, соответствующее ключу, или нулевой указатель,
+            если такого ключа в отображении нет.
+
+                Асимптотика.
+
+            Время: O(log_k(N)).
+            Память: O(1).
+         */
+        const mapped_type * find (const key_type & key) const
+        {
+            const auto position = m_keys.find(key);
+            return position != m_keys.end() ? &m_mapped[position.index()] : nullptr;
+        }
+
+        mapped_type * find (const key_type & key)
+        {
+            const auto position = m_keys.find(key);
+            return position != m_keys.end() ? &m_mapped[position.index()] : nullptr;
+        }
+
+        //!     Значение по ключу.
+        /*!
+                Возвращает ссылку на значение, соответствующее ключу. Если такого ключа нет, то
+            бросает исключение std::out_of_range.
+         */
+        const mapped_type & at (const key_type & key) const
+        {
+            if (const auto mapped = find(key))
+            {
+                return *mapped;
+            }
+            throw std::out_of_range("Ключ не найден.");
+        }
+
+        mapped_type & at (const key_type & key)
+        {
+            if (const auto mapped = find(key))
+            {
+                return *mapped;
+            }
+            throw std::out_of_range("Ключ не найден.");
+        }
+
+        bool contains (const key_type & key) const
+        {
+            return m_keys.find(key) != m_keys.end();
+        }
+
+        //!     Множество ключей.
+        /*!
+                Позволяет обходить ключи, в том числе в порядке возрастания, и искать грани.
+            Значение ключа, на который указывает итератор "i" множества ключей, — это
+            mapped(i.index()).
+         */
+        const key_set_type & keys () const
+        {
+            return m_keys;
+        }
+
+        //!     Значение, лежащее на заданном месте раскладки.
+        const mapped_type & mapped (std::size_t index) const
+        {
+            return m_mapped[index];
+        }
+
+        size_type size () const
+        {
+            return m_keys.size();
+        }
+
+        bool empty () const
+        {
+            return m_keys.empty();
+        }
+
+    private:
+        struct key_of
+        {
+            const key_type & operator () (const value_type & value) const
+            {
+                return value.first;
+            }
+        };
+
+        k_ary_search_map (std::vector<value_type> && ordered, std::size_t arity, const key_compare & compare):
+            k_ary_search_map(container::unique_ordered_tag, ordered.begin(), ordered.end(), arity, compare)
+        {
+        }
+
+        template <typename RandomAccessIterator>
+        static std::vector<value_type>
+            make_ordered
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                const key_compare & compare
+            )
+        {
+            std::vector<value_type> values(first, last);
+            const auto less =
+                [& compare] (const value_type & left, const value_type & right)
+                {
+                    return compare(left.first, right.first);
+                };
+            const auto not_less =
+                [& less] (const value_type & left, const value_type & right)
+                {
+                    return not less(left, right);
+                };
+
+            if (std::adjacent_find(values.begin(), values.end(), not_less) != values.end())
+            {
+                std::stable_sort(values.begin(), values.end(), less);
+                values.erase(std::unique(values.begin(), values.end(), not_less), values.end());
+            }
+
+            return values;
+        }
+
+        //!     Расстановка значений по местам ключей.
+        /*!
+                Обходит ключи в порядке возрастания. Очередной ключ имеет очередной ранг, и
+            значение с этим рангом записывается на место ключа в раскладке.
+
+                Асимптотика.
+
+            Время: O(N).
+            Память: O(N).
+         */
+        template <typename RandomAccessIterator>
+        void initialize_mapped (RandomAccessIterator first)
+        {
+            using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+            std::vector<std::size_t> ranks(m_keys.size());
+            std::size_t rank = 0;
+            for (auto key = m_keys.ordered_begin(); key != m_keys.ordered_end(); ++key)
+            {
+                ranks[key.index()] = rank++;
+            }
+
+            m_mapped.reserve(ranks.size());
+            for (auto key_rank: ranks)
+            {
+                m_mapped.push_back(first[static_cast<difference_type>(key_rank)].second);
+            }
+        }
+
+    private:
+        static const std::size_t default_arity = 33;
+
+    private:
+        key_set_type m_keys;
+        std::vector<mapped_type> m_mapped;
+    };
+}
+
+#endif // BURST_CONTAINER_K_ARY_SEARCH_MAP_HPP
@@ -1,30 +1,32 @@
 #ifndef BURST_CONTAINER_K_ARY_SEARCH_SET_HPP
 #define BURST_CONTAINER_K_ARY_SEARCH_SET_HPP
 
+#include <burst/container/detail/k_ary_inorder_iterator.hpp>
+#include <burst/container/detail/k_ary_search_tree.hpp>
+#include <burst/container/detail/k_ary_slot_iterator.hpp>
+#include <burst/container/detail/prefetch.hpp>
+#include <burst/container/k_ary_node_storage.hpp>
+#include <burst/container/parallel.hpp>
 #include <burst/container/unique_ordered_tag.hpp>
-#include <burst/integer/intlog.hpp>
-#include <burst/integer/intpow.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/container/container_fwd.hpp>
 #include <boost/range/iterator_range.hpp>
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <iterator>
-#include <stack>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace burst
 {
-    struct k_ary_search_set_branch
+    namespace detail
     {
-        std::size_t index;
-        std::size_t size;
-        std::size_t height;
-        std::size_t preceding_elements;
-    };
+        struct k_ary_image_access;
+    }
 
     //!     Множество, основанное на k-местном дереве поиска.
     /*!
@@ -48,20 +50,35 @@ namespace burst
             значение.
 
                 bool Compare (Value [const &], Value [const &])
+
+        \tparam NodeStorage
+            Политика хранения узлов дерева в массиве.
+            По-умолчанию узлы лежат вплотную друг к другу (container::packed_nodes). Если
+            задать container::cache_aligned_nodes, то каждый узел будет начинаться с границы
+            строки кэша и занимать наименьшее возможное число строк, так что при спуске по
+            дереву на каждом уровне будет не более одного промаха кэша на каждые 64 байта узла.
+            Платой за это служит дополнительная память на выравнивание узлов.
      */
-    template<typename Value, typename Compare = std::less<Value>>
+    template
+    <
+        typename Value,
+        typename Compare = std::less<Value>,
+        typename NodeStorage = container::packed_nodes
+    >
     class k_ary_search_set
     {
     public:
         using value_type = Value;
         using value_compare = Compare;
+        using node_storage = NodeStorage;
 
     private:
-        using value_container_type = std::vector<value_type>;
+        using value_container_type = typename node_storage::template buffer_type<value_type>;
 
     public:
-        using iterator = typename value_container_type::iterator;
-        using const_iterator = typename value_container_type::const_iterator;
+        using iterator = detail::k_ary_slot_iterator<typename value_container_type::iterator, node_storage>;
+        using const_iterator = detail::k_ary_slot_iterator<typename value_container_type::const_iterator, node_storage>;
+        using ordered_iterator = detail::k_ary_inorder_iterator<typename value_container_type::const_iterator>;
         using size_type = typename value_container_type::size_type;
         using difference_type = typename value_container_type::difference_type;
 
@@ -76,7 +93,7 @@ namespace burst
                 Асимптотика.
 
             Время: O(N), N = |[first, last)| — размер дерева.
-            Память: O(log_k(N) + k).
+            Память: O(1).
                 Учитывается только собственная память конструктора. Созданное дерево, естественно,
                 содержит ровно N элементов.
          */
@@ -89,8 +106,9 @@ namespace burst
                     std::size_t arity = default_arity,
                     const value_compare & compare = value_compare()
                 ):
-            m_values(static_cast<size_type>(std::distance(first, last))),
+            m_size(0),
             m_arity(arity),
+            m_node_stride(node_storage::template node_stride<value_type>(arity - 1)),
             m_compare(compare)
         {
             initialize_trusted(boost::make_iterator_range(first, last));
@@ -117,12 +135,65 @@ namespace burst
                     std::size_t arity = default_arity,
                     const value_compare & compare = value_compare()
                 ):
+            m_size(0),
             m_arity(arity),
+            m_node_stride(node_storage::template node_stride<value_type>(arity - 1)),
             m_compare(compare)
         {
             initialize(boost::make_iterator_range(first, last));
         }
 
+        //!     Параллельное создание множества из упорядоченного набора.
+        /*!
+                То же, что и создание из упорядоченного набора, но элементы расставляются по местам
+            в нескольких потоках. Количество потоков задаётся первым параметром (см.
+            container::parallel).
+
+                Асимптотика.
+
+            Время: O(N / P + P k log_k(N)), N = |[first, last)|, P — количество потоков.
+            Память: O(P).
+         */
+        template <typename RandomAccessIterator>
+        k_ary_search_set
+                (
+                    container::parallel_t parallel,
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_size(0),
+            m_arity(arity),
+            m_node_stride(node_storage::template node_stride<value_type>(arity - 1)),
+            m_compare(compare)
+        {
+            initialize_trusted(boost::make_iterator_range(first, last), parallel.thread_count);
+        }
+
+        //!     Параллельное создание множества из набора, заданного итераторами.
+        /*!
+                Если набор неупорядочен, то он сначала упорядочивается в одном потоке, а затем
+            элементы расставляются по местам параллельно.
+         */
+        template <typename RandomAccessIterator>
+        k_ary_search_set
+                (
+                    container::parallel_t parallel,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    std::size_t arity = default_arity,
+                    const value_compare & compare = value_compare()
+                ):
+            m_size(0),
+            m_arity(arity),
+            m_node_stride(node_storage::template node_stride<value_type>(arity - 1)),
+            m_compare(compare)
+        {
+            initialize(boost::make_iterator_range(first, last), parallel.thread_count);
+        }
+
         //!     Создание множества из упорядоченного набора, представленного списком инициализации.
         /*!
                 Принимает std::initializer_list, заполненный элементами которые должны быть в
@@ -133,7 +204,7 @@ namespace burst
                 Асимптотика.
 
             Время: O(N), где N = |values|.
-            Память: O(log_k(N) + k).
+            Память: O(1).
          */
         k_ary_search_set
                 (
@@ -142,8 +213,9 @@ namespace burst
                     std::size_t arity = default_arity,
                     const value_compare & compare = value_compare()
                 ):
-            m_values(values.size()),
+            m_size(0),
             m_arity(arity),
+            m_node_stride(node_storage::template node_stride<value_type>(arity - 1)),
             m_compare(compare)
         {
             initialize_trusted(boost::make_iterator_range(values));
@@ -168,14 +240,18 @@ namespace burst
                     std::size_t arity = default_arity,
                     const value_compare & compare = value_compare()
                 ):
+            m_size(0),
             m_arity(arity),
+            m_node_stride(node_storage::template node_stride<value_type>(arity - 1)),
             m_compare(compare)
         {
             initialize(boost::make_iterator_range(values));
         }
 
         k_ary_search_set ():
-            m_arity(0)
+            m_size(0),
+            m_arity(0),
+            m_node_stride(0)
         {
         }
 
@@ -202,223 +278,365 @@ namespace burst
             return find_impl(value);
         }
 
+        //!     Поиск набора элементов.
+        /*!
+                Принимает диапазон искомых значений и итератор, в который для каждого из них по
+            порядку записывается то же, что вернул бы метод find: итератор на найденный элемент или
+            end().
+                Поиски выполняются группами по batch_group_size штук. Спуск по дереву для всех
+            поисков группы идёт одновременно, уровень за уровнем, и, как только становится известен
+            следующий узел очередного поиска, он запрашивается из памяти заранее. Пока процессор
+            обрабатывает остальные поиски группы, узел успевает загрузиться, так что промахи кэша
+            разных поисков перекрываются во времени. На больших множествах это в несколько раз
+            увеличивает пропускную способность по сравнению с последовательными вызовами find.
+
+                Асимптотика.
+
+            Время: O(M log_k(N)), M = |[first, last)|.
+            Память: O(1).
+         */
+        template <typename ForwardIterator, typename OutputIterator>
+        OutputIterator find_batch (ForwardIterator first, ForwardIterator last, OutputIterator result) const
+        {
+            std::array<ForwardIterator, batch_group_size> keys;
+            std::array<std::size_t, batch_group_size> node_indices;
+            std::array<std::size_t, batch_group_size> node_numbers;
+            std::array<bool, batch_group_size> finished;
+
+            while (first != last)
+            {
+                std::size_t group_size = 0;
+                for (; group_size < batch_group_size && first != last; ++group_size, ++first)
+                {
+                    keys[group_size] = first;
+                    node_indices[group_size] = 0;
+                    node_numbers[group_size] = 0;
+                    finished[group_size] = m_size == 0;
+                }
+
+                for (auto active = group_size; active > 0; /* пусто */)
+                {
+                    active = 0;
+                    for (std::size_t i = 0; i < group_size; ++i)
+                    {
+                        if (not finished[i])
+                        {
+                            if (search_node(*keys[i], node_indices[i], node_numbers[i]) || node_indices[i] >= m_size)
+                            {
+                                finished[i] = true;
+                            }
+                            else
+                            {
+                                prefetch_node(node_numbers[i]);
+                                ++active;
+                            }
+                        }
+                    }
+                }
+
+                for (std::size_t i = 0; i < group_size; ++i)
+                {
+                    *result++ = cbegin() + static_cast<difference_type>(std::min(node_indices[i], m_size));
+                }
+            }
+
+            return result;
+        }
+
+        //!     Первый элемент, не меньший заданного.
+        /*!
+                Возвращает итератор упорядоченного обхода на наименьший элемент множества, не
+            меньший value, или ordered_end(), если такого нет.
+
+                Асимптотика.
+
+            Время: O(log_k(N) * log(k)).
+            Память: O(1).
+         */
+        ordered_iterator lower_bound (const value_type & value) const
+        {
+            return bound(value,
+                [this] (auto first, auto last, const auto & v)
+                {
+                    return std::lower_bound(first, last, v, m_compare);
+                });
+        }
+
+        //!     Первый элемент, больший заданного.
+        /*!
+                Возвращает итератор упорядоченного обхода на наименьший элемент множества,
+            строго больший value, или ordered_end(), если такого нет.
+
+                Асимптотика.
+
+            Время: O(log_k(N) * log(k)).
+            Память: O(1).
+         */
+        ordered_iterator upper_bound (const value_type & value) const
+        {
+            return bound(value,
+                [this] (auto first, auto last, const auto & v)
+                {
+                    return std::upper_bound(first, last, v, m_compare);
+                });
+        }
+
+        //!     Диапазон элементов, равных заданному.
+        /*!
+                Поскольку элементы множества уникальны, диапазон либо пуст, либо состоит из одного
+            элемента.
+         */
+        std::pair<ordered_iterator, ordered_iterator> equal_range (const value_type & value) const
+        {
+            auto lower = lower_bound(value);
+            auto upper = lower;
+            if (lower != ordered_end() && not m_compare(value, *lower))
+            {
+                ++upper;
+            }
+            return std::make_pair(lower, upper);
+        }
+
+        //!     Начало упорядоченного обхода множества.
+        /*!
+                В отличие от begin(), проходит элементы в порядке возрастания относительно
+            отношения порядка множества. Дополнительной памяти не требует: переход к следующему
+            элементу вычисляется по номерам узлов дерева.
+         */
+        ordered_iterator ordered_begin () const
+        {
+            std::size_t node_number = 0;
+            if (m_size > 0)
+            {
+                while ((node_number * m_arity + 1) * (m_arity - 1) < m_size)
+                {
+                    node_number = node_number * m_arity + 1;
+                }
+            }
+            return make_ordered_iterator(node_number, 0);
+        }
+
+        ordered_iterator ordered_end () const
+        {
+            return m_size == 0
+                ? make_ordered_iterator(0, 0)
+                : make_ordered_iterator(m_size / (m_arity - 1), m_size % (m_arity - 1));
+        }
+
         size_type size () const
         {
-            return m_values.size();
+            return m_size;
         }
 
         bool empty () const
         {
-            return m_values.empty();
+            return m_size == 0;
+        }
+
+        std::size_t arity () const
+        {
+            return m_arity;
         }
 
         //!     Начало множества.
         /*!
-                Важно, что последовательность [begin(), end()) неупорядочена.
+                Важно, что последовательность [begin(), end()) неупорядочена. Для обхода в порядке
+            возрастания есть ordered_begin() и ordered_end().
          */
         iterator begin ()
         {
-            return m_values.begin();
+            return iterator(m_values.begin(), 0, m_arity - 1, m_node_stride);
         }
 
         iterator end ()
         {
-            return m_values.end();
+            return iterator(m_values.begin(), m_size, m_arity - 1, m_node_stride);
         }
 
         const_iterator begin () const
         {
-            return m_values.begin();
+            return cbegin();
         }
 
         const_iterator end () const
         {
-            return m_values.end();
+            return cend();
         }
 
         const_iterator cbegin () const
         {
-            return m_values.cbegin();
+            return const_iterator(m_values.cbegin(), 0, m_arity - 1, m_node_stride);
         }
 
         const_iterator cend () const
         {
-            return m_values.cend();
+            return const_iterator(m_values.cbegin(), m_size, m_arity - 1, m_node_stride);
         }
 
     private:
+        //!     Создание множества из готового хранилища узлов.
+        /*!
+                Хранилище должно содержать правильно расставленное дерево с заданными размером,
+            местностью и шагом узлов. Используется для построения множества по образу (см.
+            container::k_ary_image).
+         */
+        k_ary_search_set
+                (
+                    value_container_type values,
+                    size_type size,
+                    std::size_t arity,
+                    std::size_t node_stride,
+                    const value_compare & compare
+                ):
+            m_values(std::move(values)),
+            m_size(size),
+            m_arity(arity),
+            m_node_stride(node_stride),
+            m_compare(compare)
+        {
+        }
+
         const_iterator find_impl (const value_type & value) const
         {
             std::size_t node_index = 0;
+            // Порядковый номер узла. Нужен, чтобы найти узел в хранилище без деления.
+            std::size_t node_number = 0;
 
-            while (node_index < m_values.size())
+            while (node_index < m_size)
             {
-                const_iterator node_begin = begin() + static_cast<difference_type>(node_index);
-                const_iterator node_end = node_begin + std::min(static_cast<difference_type>(m_arity - 1), std::distance(node_begin, end()));
-
-                const_iterator search_result = std::lower_bound(node_begin, node_end, value, m_compare);
-                if (search_result != node_end && not m_compare(value, *search_result))
+                if (search_node(value, node_index, node_number))
                 {
-                    return search_result;
-                }
-                else
-                {
-                    node_index = perfect_tree_child_index
-                    (
-                        m_arity,
-                        node_index,
-                        static_cast<std::size_t>(std::distance(node_begin, search_result))
-                    );
+                    return cbegin() + static_cast<difference_type>(node_index);
                 }
             }
 
             return end();
         }
 
-        template <typename RandomAccessRange>
-        void initialize (const RandomAccessRange & range)
+        //!     Один шаг спуска по дереву.
+        /*!
+                Ищет значение в узле, заданном номером первого элемента узла и порядковым номером
+            узла. Если значение найдено, то возвращает истину, а номер первого элемента узла
+            заменяется на номер найденного элемента. Иначе возвращает ложь, а номера указывают на
+            поддерево, в котором нужно продолжать поиск.
+         */
+        bool search_node (const value_type & value, std::size_t & node_index, std::size_t & node_number) const
         {
-            if (std::is_sorted(range.begin(), range.end(), m_compare))
+            const std::size_t node_size = m_arity - 1;
+
+            const auto node_slot = node_number * m_node_stride;
+            const auto node_begin = m_values.begin() + static_cast<difference_type>(node_slot);
+            const auto node_end = node_begin + static_cast<difference_type>(std::min(node_size, m_size - node_index));
+
+            const auto search_result = std::lower_bound(node_begin, node_end, value, m_compare);
+            const auto rank = static_cast<std::size_t>(std::distance(node_begin, search_result));
+            if (search_result != node_end && not m_compare(value, *search_result))
             {
-                initialize_trusted(range);
+                node_index += rank;
+                return true;
             }
             else
             {
-                value_container_type buffer(range.begin(), range.end());
-                std::sort(buffer.begin(), buffer.end(), m_compare);
-                buffer.erase(std::unique(buffer.begin(), buffer.end(), std::not2(m_compare)), buffer.end());
-
-                initialize_trusted(boost::make_iterator_range(buffer));
+                node_index = detail::perfect_tree_child_index(m_arity, node_index, rank);
+                node_number = node_number * m_arity + rank + 1;
+                return false;
             }
         }
 
-        //!     Расстановка элементов по своим местам.
-        /*!
-                Обходит дерево по уровням и расставляет по местам в дереве элементы исходной
-            последовательности.
-
-                Асимптотика.
+        ordered_iterator make_ordered_iterator (std::size_t node_number, std::size_t position) const
+        {
+            return ordered_iterator(m_values.cbegin(), m_size, m_arity, m_node_stride, node_number, position);
+        }
 
-            Время: O(N), N — количество элементов в дереве.
-            Память: O(log_k(N) + k),
-                O(log_k(N)) памяти требуется для хранения стека при обходе узлов дерева.
-                O(k) памяти требуется для хранения счётчиков при заполнении одного узла.
+        //!     Поиск грани.
+        /*!
+                Спускается по дереву, на каждом узле находя место значения с помощью функции
+            "search_in_node". Каждый найденный в узле элемент — кандидат в ответ, а каждый
+            следующий кандидат лучше предыдущего, потому что лежит в поддереве, ограниченном
+            предыдущим кандидатом сверху.
          */
-        template <typename RandomAccessRange>
-        void initialize_trusted (const RandomAccessRange & range)
+        template <typename NodeSearch>
+        ordered_iterator bound (const value_type & value, NodeSearch search_in_node) const
         {
-            BOOST_ASSERT(std::adjacent_find(range.begin(), range.end(), std::not2(m_compare)) == range.end());
-            if (not range.empty())
-            {
-                m_values.resize(range.size());
+            const std::size_t node_size = m_arity - 1;
+            auto candidate = ordered_end();
 
-                std::stack<k_ary_search_set_branch> branches;
+            std::size_t node_index = 0;
+            std::size_t node_number = 0;
+            while (node_index < m_size)
+            {
+                const auto node_begin = m_values.begin() + static_cast<difference_type>(node_number * m_node_stride);
+                const auto node_end = node_begin + static_cast<difference_type>(std::min(node_size, m_size - node_index));
 
-                branches.push({0, size(), perfect_tree_height(m_arity, size()), 0});
-                while (not branches.empty())
+                const auto search_result = search_in_node(node_begin, node_end, value);
+                const auto rank = static_cast<std::size_t>(std::distance(node_begin, search_result));
+                if (search_result != node_end)
                 {
-                    const auto branch = branches.top();
-                    branches.pop();
-
-                    // Количество меньших элементов ветки для каждого элемента текущего узла.
-                    std::vector<std::size_t> counters;
-                    fill_counters(branch, counters);
-
-                    fill_node(branch, counters, range);
-
-                    if (counters[0] > 0)
-                    {
-                        branches.push
-                        ({
-                            perfect_tree_child_index(m_arity, branch.index, 0),
-                            counters[0],
-                            branch.height - 1,
-                            branch.preceding_elements
-                        });
-                    }
-
-                    for (std::size_t i = 1; i < counters.size() && (counters[i] - counters[i - 1] - 1) > 0; ++i)
-                    {
-                        branches.push
-                        ({
-                            perfect_tree_child_index(m_arity, branch.index, i),
-                            counters[i] - counters[i - 1] - 1,
-                            branch.height - 1,
-                            branch.preceding_elements + counters[i - 1] + 1
-                        });
-                    }
+                    candidate = make_ordered_iterator(node_number, rank);
                 }
+
+                node_index = detail::perfect_tree_child_index(m_arity, node_index, rank);
+                node_number = node_number * m_arity + rank + 1;
             }
+
+            return candidate;
         }
 
-        //!     Подсчёт счётчиков для элементов узла.
-        /*!
-                Для каждого элемента узла подсчитывает количество элементов в ветке (ветка включает
-            рассматриваемый узел), которые строго меньше этого элемента.
-         */
-        void fill_counters (const k_ary_search_set_branch & branch, std::vector<std::size_t> & counters)
+        void prefetch_node (std::size_t node_number) const
         {
-            const std::size_t max_subtree_height = branch.height - 1;
-            const std::size_t min_subtree_elements = perfect_tree_size(m_arity, max_subtree_height - 1);
-            const std::size_t max_subtree_elements = perfect_tree_size(m_arity, max_subtree_height);
-            const std::size_t elements_in_last_row = branch.size - perfect_tree_size(m_arity, branch.height - 1);
-
-            counters.resize(std::min(m_arity, branch.size + 1));
-            for (std::size_t i = 0; i < counters.size(); ++i)
-            {
-                counters[i] = i + std::min
-                (
-                    (i + 1) * min_subtree_elements + elements_in_last_row,
-                    (i + 1) * max_subtree_elements
-                );
-            }
-            BOOST_ASSERT(counters.back() == branch.size);
+            const auto node_slot = node_number * m_node_stride;
+            detail::prefetch(m_values.data() + node_slot, (m_arity - 1) * sizeof(value_type));
         }
 
-        //!     Заполнение узла нужными элементами исходного диапазона.
-        /*!
-                Для каждого элемента узла известен индекс в исходном диапазоне, по которому лежит
-            нужное значение. Осталось только скопировать его.
-         */
         template <typename RandomAccessRange>
-        void fill_node (const k_ary_search_set_branch & branch, const std::vector<std::size_t> & counters, const RandomAccessRange & range)
+        void initialize (const RandomAccessRange & range, std::size_t thread_count = 1)
         {
-            for (std::size_t element_index = 0; element_index < counters.size() - 1; ++element_index)
+            if (std::is_sorted(range.begin(), range.end(), m_compare))
             {
-                using difference_type = typename RandomAccessRange::difference_type;
-                const auto index_in_initial_range = static_cast<difference_type>(branch.preceding_elements + counters[element_index]);
-                m_values[branch.index + element_index] = range[index_in_initial_range];
+                initialize_trusted(range, thread_count);
             }
-            BOOST_ASSERT(std::is_sorted
-            (
-                m_values.begin() + static_cast<typename value_container_type::difference_type>(branch.index),
-                m_values.begin() + static_cast<typename value_container_type::difference_type>(branch.index + counters.size() - 1),
-                m_compare
-            ));
-        }
+            else
+            {
+                std::vector<value_type> buffer(range.begin(), range.end());
+                std::sort(buffer.begin(), buffer.end(), m_compare);
+                buffer.erase(std::unique(buffer.begin(), buffer.end(), std::not2(m_compare)), buffer.end());
 
-    private:
-        static std::size_t perfect_tree_size (std::size_t arity, std::size_t height)
-        {
-            return intpow(arity, height) - 1;
+                initialize_trusted(boost::make_iterator_range(buffer), thread_count);
+            }
         }
 
-        static std::size_t perfect_tree_height (std::size_t arity, std::size_t size)
-        {
-            return intlog(size, arity) + 1;
-        }
+        //!     Расстановка элементов по своим местам.
+        /*!
+                Асимптотика.
 
-        static std::size_t perfect_tree_child_index (std::size_t arity, std::size_t parent_index, std::size_t child_number)
+            Время: O(N / P + P k log_k(N)), N — количество элементов в дереве, P — количество
+                потоков.
+            Память: O(P).
+         */
+        template <typename RandomAccessRange>
+        void initialize_trusted (const RandomAccessRange & range, std::size_t thread_count = 1)
         {
-            return parent_index * arity + (child_number + 1) * (arity - 1);
+            BOOST_ASSERT(std::adjacent_find(range.begin(), range.end(), std::not2(m_compare)) == range.end());
+            m_size = static_cast<size_type>(range.size());
+            const auto node_count = (m_size + m_arity - 2) / (m_arity - 1);
+            m_values.resize(node_count * m_node_stride);
+            detail::arrange_k_ary_search_tree(range, m_arity, begin(), thread_count);
         }
 
     private:
         static const std::size_t default_arity = 33;
 
+    public:
+        //!     Количество поисков, одновременно выполняемых методом find_batch.
+        static const std::size_t batch_group_size = 16;
+
     private:
+        friend struct detail::k_ary_image_access;
+
         value_container_type m_values;
-        const std::size_t m_arity;
+        size_type m_size;
+        std::size_t m_arity;
+        std::size_t m_node_stride;
         value_compare m_compare;
     };
 }
@@ -0,0 +1,34 @@
+#ifndef BURST_CONTAINER_PARALLEL_HPP
+#define BURST_CONTAINER_PARALLEL_HPP
+
+#include <cstddef>
+#include <thread>
+
+namespace burst
+{
+    namespace container
+    {
+        //!     Указание построить контейнер параллельно.
+        /*!
+                Передаётся в качестве дополнительного параметра в конструктор контейнера, если
+            нужно, чтобы построение выполнялось в нескольких потоках.
+         */
+        struct parallel_t
+        {
+            //!     Количество потоков, включая вызывающий.
+            std::size_t thread_count;
+        };
+
+        //!     Функция для создания указания построить контейнер параллельно.
+        /*!
+                Принимает количество потоков. По-умолчанию берётся количество потоков, которые
+            аппаратура может выполнять одновременно.
+         */
+        inline parallel_t parallel (std::size_t thread_count = std::thread::hardware_concurrency())
+        {
+            return parallel_t{thread_count};
+        }
+    } // namespace container
+} // namespace burst
+
+#endif // BURST_CONTAINER_PARALLEL_HPP
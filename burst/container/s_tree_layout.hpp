@@ -0,0 +1,195 @@
+#ifndef BURST_CONTAINER_S_TREE_LAYOUT_HPP
+#define BURST_CONTAINER_S_TREE_LAYOUT_HPP
+
+#include <burst/container/aligned_allocator.hpp>
+#include <burst/container/detail/count_less.hpp>
+#include <burst/container/detail/prefetch.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    namespace container
+    {
+        //!     Раскладка неявного B+-дерева (S-дерева).
+        /*!
+                Элементы хранятся в листьях — это просто упорядоченный массив, разбитый на узлы
+            по NodeSize элементов. Над листьями надстраиваются слои внутренних узлов, в каждом
+            из которых тоже NodeSize ключей и (NodeSize + 1) детей. Номера детей вычисляются
+            арифметически, так что указатели не хранятся.
+                i-й ключ внутреннего узла — это наименьший элемент (i + 1)-го поддерева. Поэтому
+            номер поддерева, в котором лежит нижняя грань, равен количеству ключей узла, меньших
+            искомого значения. Все ключи узла сравниваются без ветвлений, а для целых чисел с
+            естественным порядком — векторными командами.
+                В отличие от k-местного дерева, поиск всегда доходит до листа, зато на каждом
+            уровне нужен ровно один узел, а не проверка на равенство, и высота дерева на единицу
+            меньше. Недостающие ключи и элементы дополняются наибольшим элементом множества.
+                Хорошо работает при небольшом количестве элементов на узел (узел — это строка
+            кэша) и на множествах, помещающихся в кэш последнего уровня.
+
+            \tparam NodeSize
+                Количество ключей в узле.
+         */
+        template <std::size_t NodeSize = 16>
+        struct s_tree_layout
+        {
+            static_assert(NodeSize > 0, "Узел должен содержать хотя бы один ключ.");
+
+            template <typename Value, typename Compare>
+            class tree
+            {
+            private:
+                using value_container_type = std::vector<Value, aligned_allocator<Value, detail::prefetch_line_size>>;
+
+            public:
+                using const_iterator = typename value_container_type::const_iterator;
+
+                tree ():
+                    m_size(0)
+                {
+                }
+
+                //!     Построение из упорядоченного набора уникальных элементов.
+                /*!
+                        Асимптотика.
+
+                    Время: O(N).
+                    Память: O(log_B(N)), B = NodeSize.
+                 */
+                template <typename RandomAccessRange>
+                tree (const RandomAccessRange & range, const Compare & compare):
+                    m_size(static_cast<std::size_t>(range.size())),
+                    m_compare(compare)
+                {
+                    if (m_size == 0)
+                    {
+                        return;
+                    }
+
+                    std::vector<std::size_t> node_counts{(m_size + NodeSize - 1) / NodeSize};
+                    while (node_counts.back() > 1)
+                    {
+                        node_counts.push_back((node_counts.back() + NodeSize) / (NodeSize + 1));
+                    }
+
+                    m_layer_offsets.push_back(0);
+                    for (auto node_count: node_counts)
+                    {
+                        m_layer_offsets.push_back(m_layer_offsets.back() + node_count * NodeSize);
+                    }
+
+                    const auto & max = range[static_cast<typename RandomAccessRange::difference_type>(m_size - 1)];
+                    m_values.assign(m_layer_offsets.back(), max);
+                    std::copy(range.begin(), range.end(), m_values.begin());
+
+                    // Первый лист поддерева с корнем в узле j слоя h имеет номер j * (B + 1)^h.
+                    std::size_t leaves_per_child = 1;
+                    for (std::size_t layer = 1; layer < node_counts.size(); ++layer)
+                    {
+                        for (std::size_t key = 0; key < node_counts[layer] * NodeSize; ++key)
+                        {
+                            const auto child = key / NodeSize * (NodeSize + 1) + key % NodeSize + 1;
+                            const auto first = child * leaves_per_child * NodeSize;
+                            if (first < m_size)
+                            {
+                                m_values[m_layer_offsets[layer] + key] = m_values[first];
+                            }
+                        }
+                        leaves_per_child *= NodeSize + 1;
+                    }
+                }
+
+                const_iterator find (const Value & value) const
+                {
+                    if (m_size == 0 || m_compare(m_values[m_size - 1], value))
+                    {
+                        return end();
+                    }
+
+                    const auto values = m_values.data();
+
+                    std::size_t node = 0;
+                    for (auto layer = m_layer_offsets.size() - 2; layer > 0; --layer)
+                    {
+                        const auto rank = count_less(values + m_layer_offsets[layer] + node * NodeSize, value);
+                        node = node * (NodeSize + 1) + rank;
+                    }
+                    // Если все элементы листа меньше искомого, то нижняя грань — первый элемент
+                    // следующего листа, который лежит в массиве сразу за текущим.
+                    const auto position = node * NodeSize + count_less(values + node * NodeSize, value);
+
+                    if (position < m_size && not m_compare(value, values[position]))
+                    {
+                        return m_values.begin() + static_cast<std::ptrdiff_t>(position);
+                    }
+                    else
+                    {
+                        return end();
+                    }
+                }
+
+                //!     Начало множества.
+                /*!
+                        Листья дерева — это упорядоченный массив, поэтому [begin(), end())
+                    упорядочен.
+                 */
+                const_iterator begin () const
+                {
+                    return m_values.begin();
+                }
+
+                const_iterator end () const
+                {
+                    return m_values.begin() + static_cast<std::ptrdiff_t>(m_size);
+                }
+
+                std::size_t size () const
+                {
+                    return m_size;
+                }
+
+            private:
+                using is_natural_integer_order =
+                    std::integral_constant
+                    <
+                        bool,
+                        std::is_integral<Value>::value && std::is_same<Compare, std::less<Value>>::value
+                    >;
+
+                std::size_t count_less (const Value * node, const Value & value) const
+                {
+                    return count_less(node, value, is_natural_integer_order{});
+                }
+
+                std::size_t count_less (const Value * node, const Value & value, std::true_type) const
+                {
+                    return detail::count_less<NodeSize>(node, value);
+                }
+
+                std::size_t count_less (const Value * node, const Value & value, std::false_type) const
+                {
+                    std::size_t count = 0;
+                    for (std::size_t i = 0; i < NodeSize; ++i)
+                    {
+                        count += static_cast<std::size_t>(m_compare(node[i], value));
+                    }
+                    return count;
+                }
+
+            private:
+                value_container_type m_values;
+                std::vector<std::size_t> m_layer_offsets;
+                std::size_t m_size;
+                Compare m_compare;
+            };
+        };
+    } // namespace container
+} // namespace burst
+
+#endif // BURST_CONTAINER_S_TREE_LAYOUT_HPP
@@ -0,0 +1,230 @@
+#ifndef BURST_CONTAINER_SCHEMA_TUPLE_HPP
+#define BURST_CONTAINER_SCHEMA_TUPLE_HPP
+
+#include <burst/container/detail/dynamic_tuple_management.hpp>
+#include <burst/container/dynamic_tuple_schema.hpp>
+#include <burst/variadic.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace burst
+{
+    //!     Динамический кортеж с разделяемой схемой.
+    /*!
+            Неоднородный кортеж фиксированного состава, который, в отличие от dynamic_tuple, не
+        хранит описание своих объектов, а ссылается на общую для многих кортежей схему
+        (dynamic_tuple_schema). Поэтому кортеж — это только указатель на схему и один блок
+        памяти с самими объектами, а отступы объектов одинаковы во всех кортежах схемы.
+            Предназначен для большого количества строк одинакового состава, который известен
+        только во время исполнения: метаданные не дублируются в каждой строке, на каждую строку
+        приходится одно выделение памяти, а если все типы схемы тривиально копируемы, то строка
+        копируется одним вызовом std::memcpy.
+            Состав кортежа неизменен: объекты создаются в конструкторе и разрушаются в
+        деструкторе.
+     */
+    class schema_tuple
+    {
+    public:
+        using schema_type = dynamic_tuple_schema;
+        using schema_pointer = std::shared_ptr<const schema_type>;
+        using size_type = schema_type::size_type;
+
+    public:
+        //!     Создание кортежа по схеме.
+        /*!
+                Принимает схему и объекты, количество и типы которых должны в точности совпадать
+            с количеством и типами объектов схемы.
+         */
+        template <typename ... Types>
+        explicit schema_tuple (schema_pointer schema, Types && ... objects):
+            m_schema(std::move(schema)),
+            m_data(allocate(m_schema->volume()))
+        {
+            BOOST_ASSERT(m_schema->size() == sizeof...(Types));
+
+            size_type constructed = 0;
+            try
+            {
+                BURST_EXPAND_VARIADIC(construct(constructed, std::forward<Types>(objects)));
+            }
+            catch (...)
+            {
+                const auto & schema_objects = m_schema->objects();
+                management::destroy(schema_objects.begin(), schema_objects.begin() + static_cast<std::ptrdiff_t>(constructed), data());
+                throw;
+            }
+        }
+
+        schema_tuple (schema_tuple &&) = default;
+
+        schema_tuple & operator = (schema_tuple && that)
+        {
+            this->swap(that);
+            return *this;
+        }
+
+        schema_tuple (const schema_tuple & that):
+            m_schema(that.m_schema),
+            m_data(that.m_data != nullptr ? allocate(m_schema->volume()) : nullptr)
+        {
+            // Копия перемещённого кортежа так же не владеет ни схемой, ни данными.
+            if (m_data == nullptr)
+            {
+                return;
+            }
+
+            if (m_schema->is_trivially_copyable())
+            {
+                if (m_schema->volume() > 0)
+                {
+                    std::memcpy(data(), that.data(), m_schema->volume());
+                }
+            }
+            else
+            {
+                const auto & objects = m_schema->objects();
+                management::copy(objects.begin(), objects.end(), that.data(), data());
+            }
+        }
+
+        schema_tuple & operator = (const schema_tuple & that)
+        {
+            return *this = schema_tuple(that);
+        }
+
+        ~schema_tuple ()
+        {
+            // Перемещённый кортеж не владеет ни схемой, ни данными.
+            if (m_data != nullptr && not m_schema->is_trivially_copyable())
+            {
+                const auto & objects = m_schema->objects();
+                management::destroy(objects.begin(), objects.end(), data());
+            }
+        }
+
+        void swap (schema_tuple & that)
+        {
+            this->m_schema.swap(that.m_schema);
+            this->m_data.swap(that.m_data);
+        }
+
+        //!     Доступ к неизменяемому элементу по индексу.
+        /*!
+                Сложность: O(1).
+         */
+        template <typename T>
+        const T & get (size_type index) const
+        {
+            BOOST_ASSERT(m_schema->holds<T>(index));
+            return get_by_offset<T>(offset(index));
+        }
+
+        //!     Доступ к изменяемому элементу по индексу.
+        /*!
+                Сложность: O(1).
+         */
+        template <typename T>
+        T & get (size_type index)
+        {
+            BOOST_ASSERT(m_schema->holds<T>(index));
+            return get_by_offset<T>(offset(index));
+        }
+
+        //!     Доступ к неизменяемому элементу по отступу.
+        /*!
+                Отступы одинаковы у всех кортежей одной схемы, поэтому их можно вычислить один
+            раз (см. dynamic_tuple_schema::offset) и использовать для всех кортежей.
+
+                Сложность: O(1).
+         */
+        template <typename T>
+        const T & get_by_offset (size_type offset) const
+        {
+            return *static_cast<const T *>(static_cast<const void *>(data() + offset));
+        }
+
+        //!     Доступ к изменяемому элементу по отступу.
+        /*!
+                Сложность: O(1).
+         */
+        template <typename T>
+        T & get_by_offset (size_type offset)
+        {
+            return *static_cast<T *>(static_cast<void *>(data() + offset));
+        }
+
+        //!     Отступ элемента, находящегося по заданному индексу.
+        size_type offset (size_type index) const
+        {
+            return m_schema->offset(index);
+        }
+
+        //!     Количество элементов кортежа.
+        size_type size () const
+        {
+            return m_schema->size();
+        }
+
+        //!     Суммарный объём памяти, занимаемый элементами кортежа.
+        std::size_t volume () const
+        {
+            return m_schema->volume();
+        }
+
+        //!     Информация о типе объекта по индексу.
+        const std::type_info & type (size_type index) const
+        {
+            return m_schema->type(index);
+        }
+
+        const schema_pointer & schema () const
+        {
+            return m_schema;
+        }
+
+    private:
+        template <typename T>
+        void construct (size_type & index, T && object)
+        {
+            using raw_type = std::decay_t<T>;
+            BOOST_ASSERT(m_schema->holds<raw_type>(index));
+
+            new (data() + offset(index)) raw_type(std::forward<T>(object));
+            ++index;
+        }
+
+        static std::unique_ptr<std::int8_t[]> allocate (std::size_t volume)
+        {
+            return std::unique_ptr<std::int8_t[]>(new std::int8_t[volume]);
+        }
+
+        std::int8_t * data ()
+        {
+            return m_data.get();
+        }
+
+        const std::int8_t * data () const
+        {
+            return m_data.get();
+        }
+
+    private:
+        schema_pointer m_schema;
+        std::unique_ptr<std::int8_t[]> m_data;
+    };
+
+    inline void swap (schema_tuple & left, schema_tuple & right)
+    {
+        left.swap(right);
+    }
+} // namespace burst
+
+#endif // BURST_CONTAINER_SCHEMA_TUPLE_HPP
@@ -0,0 +1,233 @@
+#ifndef BURST_CONTAINER_STATIC_K_ARY_SEARCH_SET_HPP
+#define BURST_CONTAINER_STATIC_K_ARY_SEARCH_SET_HPP
+
+#include <burst/container/detail/count_less.hpp>
+#include <burst/container/detail/k_ary_search_tree.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    //!     Множество целых чисел, основанное на k-местном дереве поиска с местностью, известной на
+    //!     этапе компиляции.
+    /*!
+            Устроено так же, как и k_ary_search_set, но местность дерева задаётся параметром
+        шаблона, а элементы могут быть только целыми числами с естественным порядком.
+            Благодаря этому каждый узел дерева содержит ровно (k - 1) элементов (последний узел
+        дополняется наибольшими значениями типа), и поиск внутри узла сводится к подсчёту ключей,
+        меньших искомого, без ветвлений и без двоичного поиска. Для 32- и 64-битных чисел подсчёт
+        выполняется векторными сравнениями с подсчётом единичных битов маски, если это позволяет
+        целевая архитектура.
+            По-умолчанию местность подбирается так, чтобы узел занимал ровно 64 байта, то есть одну
+        строку кэша: 17 для 32-битных чисел, 9 для 64-битных.
+
+        \tparam Value
+            Тип данных, хранящихся в множестве. Должен быть целочисленным.
+        \tparam Arity
+            Местность дерева.
+     */
+    template <typename Value, std::size_t Arity = 64 / sizeof(Value) + 1>
+    class static_k_ary_search_set
+    {
+        static_assert(std::is_integral<Value>::value, "Элементы множества должны быть целыми числами.");
+        static_assert(Arity > 1, "Местность дерева должна быть больше единицы.");
+
+    public:
+        using value_type = Value;
+        using value_compare = std::less<Value>;
+
+    private:
+        using value_container_type = std::vector<value_type>;
+
+    public:
+        using iterator = typename value_container_type::const_iterator;
+        using const_iterator = typename value_container_type::const_iterator;
+        using size_type = typename value_container_type::size_type;
+        using difference_type = typename value_container_type::difference_type;
+
+        static const std::size_t arity = Arity;
+
+    public:
+        //!     Создание множества из упорядоченного набора, представленного итераторами.
+        /*!
+                Принимает два итератора, которые задают набор элементов, которые должны быть в
+            результирующем множестве, а также фиктивный элемент — метку, обозначающую, что
+            входной набор элементов уже упорядочен и элементы в нём уникальны.
+
+                Асимптотика.
+
+            Время: O(N), N = |[first, last)| — размер дерева.
+            Память: O(1).
+         */
+        template <typename RandomAccessIterator>
+        static_k_ary_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last
+                )
+        {
+            initialize_trusted(boost::make_iterator_range(first, last));
+        }
+
+        //!     Создание множества из набора, заданного итераторами.
+        /*!
+                Асимптотика.
+
+            Время:
+                1. O(N), если набор упорядочен.
+                2. O(N logN), если набор неупорядочен,
+                где N = |[first, last)|.
+            Память: O(log_k(N) + k).
+         */
+        template <typename RandomAccessIterator>
+        static_k_ary_search_set (RandomAccessIterator first, RandomAccessIterator last)
+        {
+            initialize(boost::make_iterator_range(first, last));
+        }
+
+        static_k_ary_search_set (container::unique_ordered_tag_t, std::initializer_list<value_type> values)
+        {
+            initialize_trusted(boost::make_iterator_range(values));
+        }
+
+        static_k_ary_search_set (std::initializer_list<value_type> values)
+        {
+            initialize(boost::make_iterator_range(values));
+        }
+
+        static_k_ary_search_set ():
+            m_size(0)
+        {
+        }
+
+    public:
+        //!     Поиск элемента в множестве.
+        /*!
+                Если искомый элемент существует в множестве, то возвращается итератор на него. Если
+            не существует, то возвращается end().
+                На каждом уровне дерева номер перехода в поддерево вычисляется как количество
+            ключей узла, меньших искомого значения.
+
+                Асимптотика.
+
+            Время: O(log_k(N) * k / w),
+                k — местность дерева,
+                N — количество элементов в дереве,
+                w — количество ключей, сравниваемых одной векторной командой.
+            Память: O(1).
+         */
+        const_iterator find (value_type value) const
+        {
+            const auto nodes = m_values.data();
+
+            std::size_t node_index = 0;
+            while (node_index < m_size)
+            {
+                const auto rank = detail::count_less<node_size>(nodes + node_index, value);
+                const auto position = node_index + rank;
+                if (rank < node_size && position < m_size && nodes[position] == value)
+                {
+                    return begin() + static_cast<difference_type>(position);
+                }
+
+                node_index = detail::perfect_tree_child_index(Arity, node_index, rank);
+            }
+
+            return end();
+        }
+
+        size_type size () const
+        {
+            return m_size;
+        }
+
+        bool empty () const
+        {
+            return m_size == 0;
+        }
+
+        //!     Начало множества.
+        /*!
+                Важно, что последовательность [begin(), end()) неупорядочена.
+         */
+        const_iterator begin () const
+        {
+            return m_values.begin();
+        }
+
+        const_iterator end () const
+        {
+            return m_values.begin() + static_cast<difference_type>(m_size);
+        }
+
+        const_iterator cbegin () const
+        {
+            return begin();
+        }
+
+        const_iterator cend () const
+        {
+            return end();
+        }
+
+    private:
+        template <typename RandomAccessRange>
+        void initialize (const RandomAccessRange & range)
+        {
+            if (std::adjacent_find(range.begin(), range.end(), std::greater_equal<value_type>()) == range.end())
+            {
+                initialize_trusted(range);
+            }
+            else
+            {
+                value_container_type buffer(range.begin(), range.end());
+                std::sort(buffer.begin(), buffer.end());
+                buffer.erase(std::unique(buffer.begin(), buffer.end()), buffer.end());
+
+                initialize_trusted(boost::make_iterator_range(buffer));
+            }
+        }
+
+        //!     Расстановка элементов по своим местам.
+        /*!
+                Хранилище дополняется до целого количества узлов наибольшими значениями типа. Они
+            не меньше любого искомого значения, поэтому не влияют на выбор поддерева, а
+            совпадение с ними отсекается проверкой на размер множества.
+         */
+        template <typename RandomAccessRange>
+        void initialize_trusted (const RandomAccessRange & range)
+        {
+            BOOST_ASSERT(std::adjacent_find(range.begin(), range.end(), std::greater_equal<value_type>()) == range.end());
+
+            m_size = static_cast<size_type>(range.size());
+            m_values.assign((m_size + node_size - 1) / node_size * node_size, std::numeric_limits<value_type>::max());
+            detail::arrange_k_ary_search_tree(range, Arity, m_values.begin());
+        }
+
+    private:
+        static const std::size_t node_size = Arity - 1;
+
+    private:
+        value_container_type m_values;
+        size_type m_size;
+    };
+
+    template <typename Value, std::size_t Arity>
+    const std::size_t static_k_ary_search_set<Value, Arity>::arity;
+
+    template <typename Value, std::size_t Arity>
+    const std::size_t static_k_ary_search_set<Value, Arity>::node_size;
+}
+
+#endif // BURST_CONTAINER_STATIC_K_ARY_SEARCH_SET_HPP
@@ -0,0 +1,199 @@
+#ifndef BURST_CONTAINER_STATIC_SEARCH_SET_HPP
+#define BURST_CONTAINER_STATIC_SEARCH_SET_HPP
+
+#include <burst/container/eytzinger_layout.hpp>
+#include <burst/container/unique_ordered_tag.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+namespace burst
+{
+    //!     Неизменяемое множество с поиском по неявному дереву.
+    /*!
+            Элементы хранятся в одном массиве, расставленные так, чтобы поиск обращался к памяти
+        как можно реже и как можно более предсказуемо. Конкретная расстановка задаётся
+        раскладкой:
+            1. eytzinger_layout — двоичное дерево в порядке обхода в ширину с предвыборкой;
+            2. s_tree_layout — неявное B+-дерево;
+            3. k_ary_layout — k-местное дерево поиска, как в k_ary_search_set.
+            Какая из раскладок быстрее, зависит от размера множества, типа элементов и
+        архитектуры, поэтому лучше выбирать раскладку по результатам измерений.
+            Все раскладки строятся одинаково — из упорядоченного набора уникальных элементов.
+        Если набор неупорядочен, то множество само упорядочивает его и удаляет повторы.
+
+        \tparam Value
+            Тип данных, хранящихся в множестве.
+        \tparam Layout
+            Раскладка. Должна содержать шаблон класса tree<Value, Compare>, который строится из
+            упорядоченного диапазона уникальных элементов и отношения порядка и предоставляет
+            тип const_iterator и методы find, begin, end и size.
+        \tparam Compare
+            Отношение строгого порядка на элементах множества.
+     */
+    template
+    <
+        typename Value,
+        typename Layout = container::eytzinger_layout,
+        typename Compare = std::less<Value>
+    >
+    class static_search_set
+    {
+    public:
+        using value_type = Value;
+        using value_compare = Compare;
+        using layout_type = Layout;
+
+    private:
+        using tree_type = typename layout_type::template tree<value_type, value_compare>;
+
+    public:
+        using iterator = typename tree_type::const_iterator;
+        using const_iterator = typename tree_type::const_iterator;
+        using size_type = std::size_t;
+
+    public:
+        //!     Создание множества из упорядоченного набора, представленного итераторами.
+        /*!
+                Принимает два итератора, которые задают набор элементов, которые должны быть в
+            результирующем множестве, отношение порядка на элементах, а также фиктивный
+            элемент — метку, обозначающую, что входной набор элементов уже упорядочен и элементы
+            в нём уникальны.
+
+                Асимптотика.
+
+            Время: O(N), N = |[first, last)|.
+         */
+        template <typename RandomAccessIterator>
+        static_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    const value_compare & compare = value_compare()
+                ):
+            m_tree(boost::make_iterator_range(first, last), compare)
+        {
+        }
+
+        //!     Создание множества из набора, заданного итераторами.
+        /*!
+                Асимптотика.
+
+            Время:
+                1. O(N), если набор упорядочен.
+                2. O(N logN), если набор неупорядочен,
+                где N = |[first, last)|.
+            Память: O(N), если набор неупорядочен.
+         */
+        template <typename RandomAccessIterator>
+        static_search_set
+                (
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    const value_compare & compare = value_compare()
+                ):
+            m_tree(make_tree(boost::make_iterator_range(first, last), compare))
+        {
+        }
+
+        static_search_set
+                (
+                    container::unique_ordered_tag_t,
+                    std::initializer_list<value_type> values,
+                    const value_compare & compare = value_compare()
+                ):
+            m_tree(boost::make_iterator_range(values), compare)
+        {
+        }
+
+        static_search_set
+                (
+                    std::initializer_list<value_type> values,
+                    const value_compare & compare = value_compare()
+                ):
+            m_tree(make_tree(boost::make_iterator_range(values), compare))
+        {
+        }
+
+        static_search_set () = default;
+
+    public:
+        //!     Поиск элемента в множестве.
+        /*!
+                Если искомый элемент существует в множестве, то возвращается итератор на него. Если
+            не существует, то возвращается end().
+
+                Асимптотика.
+
+            Время: O(logN).
+            Память: O(1).
+         */
+        const_iterator find (const value_type & value) const
+        {
+            return m_tree.find(value);
+        }
+
+        size_type size () const
+        {
+            return m_tree.size();
+        }
+
+        bool empty () const
+        {
+            return size() == 0;
+        }
+
+        //!     Начало множества.
+        /*!
+                Упорядоченность последовательности [begin(), end()) зависит от раскладки.
+         */
+        const_iterator begin () const
+        {
+            return m_tree.begin();
+        }
+
+        const_iterator end () const
+        {
+            return m_tree.end();
+        }
+
+        const_iterator cbegin () const
+        {
+            return begin();
+        }
+
+        const_iterator cend () const
+        {
+            return end();
+        }
+
+    private:
+        template <typename RandomAccessRange>
+        static tree_type make_tree (const RandomAccessRange & range, const value_compare & compare)
+        {
+            if (std::adjacent_find(range.begin(), range.end(), std::not2(compare)) == range.end())
+            {
+                return tree_type(range, compare);
+            }
+            else
+            {
+                std::vector<value_type> buffer(range.begin(), range.end());
+                std::sort(buffer.begin(), buffer.end(), compare);
+                buffer.erase(std::unique(buffer.begin(), buffer.end(), std::not2(compare)), buffer.end());
+
+                return tree_type(boost::make_iterator_range(buffer), compare);
+            }
+        }
+
+    private:
+        tree_type m_tree;
+    };
+}
+
+#endif // BURST_CONTAINER_STATIC_SEARCH_SET_HPP
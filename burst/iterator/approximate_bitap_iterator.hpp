@@ -0,0 +1,131 @@
+#ifndef BURST_ITERATOR_APPROXIMATE_BITAP_ITERATOR_HPP
+#define BURST_ITERATOR_APPROXIMATE_BITAP_ITERATOR_HPP
+
+#include <burst/algorithm/searching/approximate_bitap.hpp>
+#include <burst/iterator/end_tag.hpp>
+
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/concepts.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    //!     Итератор приближённых вхождений образца в текст.
+    /*!
+            Обёртка, позволяющая ровно за один проход найти все места текста, где кончаются
+        вхождения образца с не более чем k ошибками.
+            Каждое вхождение задаётся структурой algorithm::approximate_match: диапазоном,
+        оканчивающимся там же, где вхождение, и количеством ошибок.
+     */
+    template <typename ApproximateBitap, typename TextRange>
+    class approximate_bitap_iterator:
+        public boost::iterator_facade
+        <
+            approximate_bitap_iterator<ApproximateBitap, TextRange>,
+            algorithm::approximate_match<typename TextRange::const_iterator>,
+            boost::forward_traversal_tag,
+            const algorithm::approximate_match<typename TextRange::const_iterator> &
+        >
+    {
+    private:
+        using searcher_type = ApproximateBitap;
+        using state_type = typename searcher_type::state_type;
+
+        BOOST_CONCEPT_ASSERT((boost::ForwardRangeConcept<TextRange>));
+        using text_range_type = TextRange;
+        using text_iterator = typename TextRange::const_iterator;
+
+        using base_type = boost::iterator_facade
+        <
+            approximate_bitap_iterator<searcher_type, text_range_type>,
+            algorithm::approximate_match<text_iterator>,
+            boost::forward_traversal_tag,
+            const algorithm::approximate_match<text_iterator> &
+        >;
+
+    public:
+        approximate_bitap_iterator (searcher_type bitap, const text_range_type & text):
+            m_bitap(std::move(bitap)),
+            m_state(m_bitap.initial_state()),
+            m_match(m_bitap.find_first(text.begin(), text.end(), m_state)),
+            m_text_end(text.end())
+        {
+        }
+
+        approximate_bitap_iterator (const approximate_bitap_iterator & begin, iterator::end_tag_t):
+            m_bitap(begin.m_bitap),
+            m_state{},
+            m_match{boost::make_iterator_range(begin.m_text_end, begin.m_text_end), 0},
+            m_text_end(begin.m_text_end)
+        {
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void increment ()
+        {
+            m_match = m_bitap.find_next(m_match, m_text_end, m_state);
+        }
+
+    private:
+        typename base_type::reference dereference () const
+        {
+            return m_match;
+        }
+
+        //!     Проверка на равенство.
+        /*!
+                Соседние вхождения в начале текста могут иметь одно и то же начало диапазона,
+            поэтому сравниваются оба конца.
+         */
+        bool equal (const approximate_bitap_iterator & that) const
+        {
+            return
+                this->m_match.range.begin() == that.m_match.range.begin() &&
+                this->m_match.range.end() == that.m_match.range.end();
+        }
+
+    private:
+        searcher_type m_bitap;
+        state_type m_state;
+        typename base_type::value_type m_match;
+        text_iterator m_text_end;
+    };
+
+    //!     Функция создания итератора на начало приближённых вхождений.
+    template <typename Value, typename Bitmask, typename Distance, typename Map, typename ForwardRange>
+    auto
+        make_approximate_bitap_iterator
+        (
+            algorithm::approximate_bitap<Value, Bitmask, Distance, Map> bitap,
+            const ForwardRange & text
+        )
+    {
+        static_assert(std::is_same<Value, typename ForwardRange::value_type>::value, "");
+        return
+            approximate_bitap_iterator<algorithm::approximate_bitap<Value, Bitmask, Distance, Map>, ForwardRange>
+            (
+                std::move(bitap),
+                text
+            );
+    }
+
+    //!     Функция создания итератора на конец приближённых вхождений.
+    template <typename Value, typename Bitmask, typename Distance, typename Map, typename ForwardRange>
+    auto
+        make_approximate_bitap_iterator
+        (
+            const approximate_bitap_iterator<algorithm::approximate_bitap<Value, Bitmask, Distance, Map>, ForwardRange> & begin,
+            iterator::end_tag_t
+        )
+    {
+        using searcher_type = algorithm::approximate_bitap<Value, Bitmask, Distance, Map>;
+        return approximate_bitap_iterator<searcher_type, ForwardRange>(begin, iterator::end_tag);
+    }
+}
+
+#endif // BURST_ITERATOR_APPROXIMATE_BITAP_ITERATOR_HPP
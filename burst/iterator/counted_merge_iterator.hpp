@@ -0,0 +1,164 @@
+#ifndef BURST_ITERATOR_COUNTED_MERGE_ITERATOR_HPP
+#define BURST_ITERATOR_COUNTED_MERGE_ITERATOR_HPP
+
+#include <burst/iterator/detail/front_value_heap.hpp>
+#include <burst/iterator/detail/range_range.hpp>
+#include <burst/iterator/end_tag.hpp>
+
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/optional.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace burst
+{
+    //!     Итератор слияния с подсчётом.
+    /*!
+            Предназначен для слияния нескольких диапазонов одного типа "на лету" так, что каждый
+        элемент выдаётся только один раз вместе с количеством его вхождений во все входные
+        диапазоны. То есть слияние рассматривается как мультимножество, и итератор перечисляет
+        пары "элемент — кратность".
+            Заменяет связку "слияние + группировка" и работает за один проход.
+            Полученный диапазон неизменяем.
+
+        \tparam RandomAccessRange
+            Тип принимаемого на вход внешнего диапазона. Он должен быть диапазоном произвольного
+            доступа, то есть удовлетворять требованиям понятия "Random Access Range".
+        \tparam Compare
+            Бинарная операция, задающая отношение строгого порядка на элементах внутренних
+            диапазонов. Если пользователем явно не указана операция, то, по-умолчанию, берётся
+            отношение "меньше", задаваемое функциональным объектом "std::less<>".
+
+            Алгоритм работы.
+
+        1. Внешний диапазон переупорядочивается в пирамиду по первым элементам внутренних
+           диапазонов, как в итераторе слияния.
+        2. Чтобы получить следующий элемент, из пирамиды достаются все диапазоны, начинающиеся с
+           наименьшего элемента, каждый из них "прокручивается" за последнее вхождение этого
+           элемента, и подсчитывается суммарное количество пропущенных вхождений. Непустые
+           диапазоны кладутся обратно в пирамиду.
+     */
+    template
+    <
+        typename RandomAccessRange,
+        typename Compare = std::less<>
+    >
+    class counted_merge_iterator:
+        public boost::iterator_facade
+        <
+            counted_merge_iterator<RandomAccessRange, Compare>,
+            std::pair<detail::range_range_value_t<RandomAccessRange>, std::size_t>,
+            boost::single_pass_traversal_tag,
+            const std::pair<detail::range_range_value_t<RandomAccessRange>, std::size_t> &
+        >
+    {
+    private:
+        using outer_range_type = RandomAccessRange;
+        using heap_type = detail::front_value_heap<outer_range_type, Compare>;
+
+        using base_type =
+            boost::iterator_facade
+            <
+                counted_merge_iterator,
+                std::pair<detail::range_range_value_t<outer_range_type>, std::size_t>,
+                boost::single_pass_traversal_tag,
+                const std::pair<detail::range_range_value_t<outer_range_type>, std::size_t> &
+            >;
+
+    public:
+        explicit counted_merge_iterator (outer_range_type ranges, Compare compare = Compare()):
+            m_heap(std::move(ranges), compare),
+            m_current{}
+        {
+            increment();
+        }
+
+        counted_merge_iterator (const counted_merge_iterator & begin, iterator::end_tag_t):
+            m_heap(begin.m_heap, iterator::end_tag),
+            m_current{}
+        {
+        }
+
+        counted_merge_iterator () = default;
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void increment ()
+        {
+            if (not m_heap.empty())
+            {
+                auto value = m_heap.top();
+                auto group = m_heap.pop_group(value);
+                m_current.emplace(std::move(value), group.occurrences);
+            }
+            else
+            {
+                m_current = boost::none;
+            }
+        }
+
+    private:
+        typename base_type::reference dereference () const
+        {
+            return *m_current;
+        }
+
+        bool equal (const counted_merge_iterator & that) const
+        {
+            return
+                static_cast<bool>(this->m_current) == static_cast<bool>(that.m_current) &&
+                this->m_heap == that.m_heap;
+        }
+
+    private:
+        heap_type m_heap;
+        boost::optional<typename base_type::value_type> m_current;
+    };
+
+    //!     Функция для создания итератора слияния с подсчётом с предикатом.
+    /*!
+            Принимает на вход диапазон диапазонов, которые нужно слить, и операцию, задающую
+        отношение строгого порядка на элементах этого диапазона.
+            Сами диапазоны должны быть упорядочены относительно этой операции.
+            Возвращает итератор на пару из наименьшего элемента и количества его вхождений.
+     */
+    template <typename RandomAccessRange, typename Compare>
+    auto make_counted_merge_iterator (RandomAccessRange ranges, Compare compare)
+    {
+        return counted_merge_iterator<RandomAccessRange, Compare>(std::move(ranges), compare);
+    }
+
+    //!     Функция для создания итератора слияния с подсчётом.
+    /*!
+            Принимает на вход диапазон диапазонов, которые нужно слить.
+            Возвращает итератор на пару из наименьшего элемента и количества его вхождений.
+            Отношение порядка для элементов диапазона выбирается по-умолчанию.
+     */
+    template <typename RandomAccessRange>
+    auto make_counted_merge_iterator (RandomAccessRange ranges)
+    {
+        return counted_merge_iterator<RandomAccessRange>(std::move(ranges));
+    }
+
+    //!     Функция для создания итератора на конец слияния с подсчётом.
+    /*!
+            Принимает на вход итератор на начало слияния и индикатор конца итератора.
+            Возвращает итератор-конец, который, если до него дойти, покажет, что элементы слияния
+        закончились.
+     */
+    template <typename RandomAccessRange, typename Compare>
+    auto
+        make_counted_merge_iterator
+        (
+            const counted_merge_iterator<RandomAccessRange, Compare> & begin,
+            iterator::end_tag_t
+        )
+    {
+        return counted_merge_iterator<RandomAccessRange, Compare>(begin, iterator::end_tag);
+    }
+} // namespace burst
+
+#endif // BURST_ITERATOR_COUNTED_MERGE_ITERATOR_HPP
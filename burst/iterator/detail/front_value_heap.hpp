@@ -0,0 +1,154 @@
+#ifndef BURST_ITERATOR_DETAIL_FRONT_VALUE_HEAP_HPP
+#define BURST_ITERATOR_DETAIL_FRONT_VALUE_HEAP_HPP
+
+#include <burst/iterator/detail/front_value_compare.hpp>
+#include <burst/iterator/detail/invert_compare.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/range/skip_to_upper_bound.hpp>
+
+#include <boost/algorithm/cxx11/all_of.hpp>
+#include <boost/algorithm/cxx11/is_sorted.hpp>
+#include <boost/assert.hpp>
+#include <boost/range/algorithm/remove_if.hpp>
+#include <boost/range/concepts.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Размер группы равных элементов.
+        struct front_value_group
+        {
+            //!     Количество диапазонов, в которых есть элемент.
+            std::size_t ranges;
+            //!     Суммарное количество вхождений элемента во все диапазоны.
+            std::size_t occurrences;
+        };
+
+        //!     Пирамида диапазонов, упорядоченная по первым элементам.
+        /*!
+                Устроена так же, как внешний диапазон итератора слияния: на вершине пирамиды
+            всегда стоит диапазон с наименьшим первым элементом, а опустевшие диапазоны
+            выбрасываются из рассмотрения.
+                В отличие от итератора слияния, позволяет за один раз изъять из всех диапазонов
+            все вхождения наименьшего элемента и узнать, сколько их было.
+         */
+        template <typename RandomAccessRange, typename Compare>
+        class front_value_heap
+        {
+        private:
+            using outer_range_type = RandomAccessRange;
+            BOOST_CONCEPT_ASSERT((boost::RandomAccessRangeConcept<outer_range_type>));
+
+        public:
+            front_value_heap (outer_range_type ranges, Compare compare):
+                m_ranges(std::move(ranges)),
+                m_compare(compare),
+                m_heap_order(compare)
+            {
+                BOOST_ASSERT(boost::algorithm::all_of(m_ranges,
+                    [& compare] (const auto & range)
+                    {
+                        return boost::algorithm::is_sorted(range, compare);
+                    }));
+
+                m_ranges.advance_end
+                (
+                    -std::distance
+                    (
+                        boost::remove_if(m_ranges, [] (const auto & r) { return r.empty(); }),
+                        std::end(m_ranges)
+                    )
+                );
+                std::make_heap(m_ranges.begin(), m_ranges.end(), m_heap_order);
+            }
+
+            //!     Создать пустую пирамиду над тем же хранилищем.
+            front_value_heap (const front_value_heap & that, iterator::end_tag_t):
+                m_ranges(std::begin(that.m_ranges), std::begin(that.m_ranges)),
+                m_compare(that.m_compare),
+                m_heap_order(that.m_heap_order)
+            {
+            }
+
+            front_value_heap () = default;
+
+            bool empty () const
+            {
+                return m_ranges.empty();
+            }
+
+            //!     Наименьший из первых элементов диапазонов.
+            decltype(auto) top () const
+            {
+                BOOST_ASSERT(not empty());
+                return m_ranges.front().front();
+            }
+
+            //!     Изъять все вхождения элемента.
+            /*!
+                    Элемент должен быть равен наименьшему элементу пирамиды.
+                    Достаёт из пирамиды все диапазоны, начинающиеся с этого элемента, продвигает
+                каждый из них за последнее вхождение элемента и возвращает в пирамиду те из них,
+                которые не опустели.
+                    Возвращает количество диапазонов, в которых был элемент, и суммарное
+                количество его вхождений.
+             */
+            template <typename Value>
+            front_value_group pop_group (const Value & value)
+            {
+                BOOST_ASSERT(not empty());
+                BOOST_ASSERT(not m_compare(value, top()) && not m_compare(top(), value));
+
+                auto group = front_value_group{0, 0};
+
+                auto heap_end = m_ranges.end();
+                while (heap_end != m_ranges.begin() && not m_compare(value, m_ranges.front().front()))
+                {
+                    std::pop_heap(m_ranges.begin(), heap_end, m_heap_order);
+                    --heap_end;
+
+                    auto first = heap_end->begin();
+                    skip_to_upper_bound(*heap_end, value, m_compare);
+
+                    ++group.ranges;
+                    group.occurrences += static_cast<std::size_t>(std::distance(first, heap_end->begin()));
+                }
+
+                for (auto range = heap_end; range != m_ranges.end(); ++range)
+                {
+                    if (not range->empty())
+                    {
+                        std::iter_swap(range, heap_end);
+                        ++heap_end;
+                        std::push_heap(m_ranges.begin(), heap_end, m_heap_order);
+                    }
+                }
+                m_ranges.advance_end(-std::distance(heap_end, m_ranges.end()));
+
+                return group;
+            }
+
+            bool operator == (const front_value_heap & that) const
+            {
+                return this->m_ranges == that.m_ranges;
+            }
+
+        private:
+            outer_range_type m_ranges;
+            Compare m_compare;
+
+            // invert_comparison устраняет путаницу с обратным порядком в пирамиде при работе с
+            // std::make(push, pop)_heap.
+            using heap_order_type = front_value_comparator<invert_comparison<Compare>>;
+            heap_order_type m_heap_order;
+        };
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST_ITERATOR_DETAIL_FRONT_VALUE_HEAP_HPP
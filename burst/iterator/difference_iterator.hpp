@@ -108,6 +108,37 @@ namespace burst
         {
         }
 
+        difference_iterator () = default;
+
+        //!     Выдать следующую порцию разности.
+        /*!
+                Записывает в [first, last) очередные элементы разности, сдвигая итератор вперёд на
+            столько элементов, сколько было записано. Останавливается, когда либо выходной
+            диапазон заполнен, либо разность закончилась.
+                Пока первый элемент уменьшаемого меньше первого элемента вычитаемого, элементы
+            уменьшаемого копируются подряд без поддержания инварианта.
+                Возвращает итератор на конец записанной части выходного диапазона.
+         */
+        template <typename ForwardIterator>
+        ForwardIterator next_batch (ForwardIterator first, ForwardIterator last)
+        {
+            while (first != last && not m_minuend.empty())
+            {
+                *first = m_minuend.front();
+                ++first;
+                m_minuend.advance_begin(1);
+
+                if (not m_minuend.empty()
+                    && not m_subtrahend.empty()
+                    && not m_compare(m_minuend.front(), m_subtrahend.front()))
+                {
+                    maintain_invariant();
+                }
+            }
+
+            return first;
+        }
+
     private:
         friend class boost::iterator_core_access;
 
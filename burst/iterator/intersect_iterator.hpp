@@ -130,6 +130,27 @@ namespace burst
 
         intersect_iterator () = default;
 
+        //!     Выдать следующую порцию пересечения.
+        /*!
+                Записывает в [first, last) очередные элементы пересечения, сдвигая итератор вперёд на
+            столько элементов, сколько было записано. Останавливается, когда либо выходной
+            диапазон заполнен, либо пересечение закончилось.
+                Продвигает итератор напрямую, без сравнения с итератором-концом на каждом шаге.
+                Возвращает итератор на конец записанной части выходного диапазона.
+         */
+        template <typename ForwardIterator>
+        ForwardIterator next_batch (ForwardIterator first, ForwardIterator last)
+        {
+            while (first != last && not m_ranges.empty())
+            {
+                *first = dereference();
+                ++first;
+                increment();
+            }
+
+            return first;
+        }
+
     private:
         friend class boost::iterator_core_access;
 
@@ -97,6 +97,45 @@ namespace burst
 
         merge_iterator () = default;
 
+        //!     Выдать следующую порцию слияния.
+        /*!
+                Записывает в [first, last) очередные элементы слияния, сдвигая итератор вперёд на
+            столько элементов, сколько было записано. Останавливается, когда либо выходной
+            диапазон заполнен, либо слияние закончилось.
+                Пока наименьший диапазон остаётся наименьшим, элементы берутся из него подряд без
+            обращения к пирамиде, поэтому на длинных упорядоченных участках порция заполняется
+            существенно быстрее, чем поэлементным продвижением итератора.
+                Возвращает итератор на конец записанной части выходного диапазона.
+         */
+        template <typename ForwardIterator>
+        ForwardIterator next_batch (ForwardIterator first, ForwardIterator last)
+        {
+            while (first != last && not m_ranges.empty())
+            {
+                std::pop_heap(m_ranges.begin(), m_ranges.end(), m_heap_order);
+                auto & range = m_ranges.back();
+
+                do
+                {
+                    *first = range.front();
+                    ++first;
+                    range.advance_begin(1);
+                }
+                while (first != last && not range.empty() && not m_heap_order(range, m_ranges.front()));
+
+                if (not range.empty())
+                {
+                    std::push_heap(m_ranges.begin(), m_ranges.end(), m_heap_order);
+                }
+                else
+                {
+                    m_ranges.advance_end(-1);
+                }
+            }
+
+            return first;
+        }
+
     private:
         friend class boost::iterator_core_access;
 
@@ -0,0 +1,298 @@
+#ifndef BURST_ITERATOR_MULTIDIFFERENCE_ITERATOR_HPP
+#define BURST_ITERATOR_MULTIDIFFERENCE_ITERATOR_HPP
+
+#include <burst/iterator/detail/front_value_compare.hpp>
+#include <burst/iterator/detail/invert_compare.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/range/skip_to_lower_bound.hpp>
+
+#include <boost/algorithm/cxx11/all_of.hpp>
+#include <boost/algorithm/cxx11/is_sorted.hpp>
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/algorithm/remove_if.hpp>
+#include <boost/range/concepts.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    //!     Итератор разности одного множества и объединения нескольких других.
+    /*!
+            Предназначен для нахождения разности между уменьшаемым и объединением произвольного
+        количества вычитаемых "на лету", то есть без использования дополнительной памяти ни для
+        хранения результирующего диапазона, ни для хранения объединения вычитаемых.
+            Диапазоны рассматриваются как мультимножества: элемент, который есть в уменьшаемом
+        n раз, а в вычитаемых — не более m раз в каждом, попадает в результат max(n - m, 0) раз.
+            Полученный диапазон изменяем. Запись в итератор изменяет значение в уменьшаемом.
+
+        \tparam ForwardRange
+            Тип уменьшаемого диапазона. Он должен быть хотя бы однонаправленным, то есть
+            удовлетворять требованиям понятия "Forward Range".
+        \tparam RandomAccessRange
+            Тип диапазона вычитаемых. Он должен быть диапазоном произвольного доступа, а его
+            элементы — однонаправленными диапазонами.
+        \tparam Compare
+            Бинарная операция, задающая отношение строгого порядка на элементах входных диапазонов.
+            Если пользователем явно не указана операция, то, по-умолчанию, берётся отношение
+            "меньше", задаваемое функциональным объектом "std::less<>".
+
+            Алгоритм работы.
+
+        0. Инвариант
+           Вычитаемые хранятся в пирамиде, на вершине которой вычитаемое с наименьшим первым
+           элементом. Итератор всегда либо установлен на конец разности, либо первый элемент
+           уменьшаемого строго меньше первого элемента каждого из вычитаемых.
+
+        1. Поиск следующего элемента разности.
+           а. Все вычитаемые, первый элемент которых меньше первого элемента уменьшаемого,
+              достаются из пирамиды, "прокручиваются" до первого элемента уменьшаемого и, если
+              не опустели, кладутся обратно.
+           б. Если на вершине пирамиды оказался элемент, равный первому элементу уменьшаемого, то
+              уменьшаемое и все вычитаемые с таким первым элементом продвигаются на один элемент
+              вперёд, после чего нужно вернуться к п.1.
+           в. Иначе текущий элемент разности найден.
+
+        2. Каждый раз, когда нужно найти следующий элемент разности, надо продвинуть уменьшаемое на
+           один элемент вперёд, после чего исполнить п.1.
+     */
+    template
+    <
+        typename ForwardRange,
+        typename RandomAccessRange,
+        typename Compare = std::less<>
+    >
+    class multidifference_iterator:
+        public boost::iterator_facade
+        <
+            multidifference_iterator<ForwardRange, RandomAccessRange, Compare>,
+            typename ForwardRange::value_type,
+            boost::single_pass_traversal_tag,
+            typename ForwardRange::reference
+        >
+    {
+    private:
+        BOOST_CONCEPT_ASSERT((boost::ForwardRangeConcept<ForwardRange>));
+        BOOST_CONCEPT_ASSERT((boost::RandomAccessRangeConcept<RandomAccessRange>));
+        using minuend_range_type = ForwardRange;
+        using subtrahends_range_type = RandomAccessRange;
+        using compare_type = Compare;
+
+        using subtrahend_iterator = typename boost::range_iterator<subtrahends_range_type>::type;
+
+        using base_type =
+            boost::iterator_facade
+            <
+                multidifference_iterator,
+                typename minuend_range_type::value_type,
+                boost::single_pass_traversal_tag,
+                typename minuend_range_type::reference
+            >;
+
+    public:
+        multidifference_iterator
+            (
+                minuend_range_type minuend,
+                subtrahends_range_type subtrahends,
+                Compare compare = Compare()
+            ):
+            m_minuend(std::move(minuend)),
+            m_subtrahends(std::move(subtrahends)),
+            m_compare(compare),
+            m_heap_order(compare)
+        {
+            BOOST_ASSERT(boost::algorithm::is_sorted(m_minuend, compare));
+            BOOST_ASSERT(boost::algorithm::all_of(m_subtrahends,
+                [& compare] (const auto & range)
+                {
+                    return boost::algorithm::is_sorted(range, compare);
+                }));
+
+            remove_empty_subtrahends();
+            std::make_heap(m_subtrahends.begin(), m_subtrahends.end(), m_heap_order);
+
+            maintain_invariant();
+        }
+
+        multidifference_iterator (const multidifference_iterator & begin, iterator::end_tag_t):
+            m_minuend(begin.m_minuend.end(), begin.m_minuend.end()),
+            m_subtrahends(std::begin(begin.m_subtrahends), std::begin(begin.m_subtrahends)),
+            m_compare(begin.m_compare),
+            m_heap_order(begin.m_heap_order)
+        {
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void remove_empty_subtrahends ()
+        {
+            m_subtrahends.advance_end
+            (
+                -std::distance
+                (
+                    boost::remove_if(m_subtrahends, [] (const auto & r) { return r.empty(); }),
+                    std::end(m_subtrahends)
+                )
+            );
+        }
+
+        void increment ()
+        {
+            m_minuend.advance_begin(1);
+            maintain_invariant();
+        }
+
+        //!     Поддержать инвариант
+        /*!
+                Приводит диапазоны в состояние, когда первый элемент уменьшаемого строго меньше
+            первого элемента каждого из вычитаемых.
+                Если в процессе продвижения уменьшаемый диапазон закончился, то итератор
+            устанавливается на конец разности.
+         */
+        void maintain_invariant ()
+        {
+            while (not m_minuend.empty())
+            {
+                const auto & goal = m_minuend.front();
+                advance_heads
+                (
+                    [this, & goal] (const auto & range)
+                    {
+                        return m_compare(range.front(), goal);
+                    },
+                    [this, & goal] (auto & range)
+                    {
+                        skip_to_lower_bound(range, goal, m_compare);
+                    }
+                );
+
+                if (m_subtrahends.empty() || m_compare(goal, m_subtrahends.front().front()))
+                {
+                    break;
+                }
+
+                advance_heads
+                (
+                    [this, & goal] (const auto & range)
+                    {
+                        return not m_compare(goal, range.front());
+                    },
+                    [] (auto & range)
+                    {
+                        range.advance_begin(1);
+                    }
+                );
+                m_minuend.advance_begin(1);
+            }
+        }
+
+        //!     Продвинуть вершины пирамиды вычитаемых.
+        /*!
+                Достаёт из пирамиды все вычитаемые, удовлетворяющие условию "should_advance"
+            (условие должно быть монотонно относительно порядка в пирамиде), продвигает каждое из
+            них с помощью "advance", а затем кладёт обратно в пирамиду те из них, которые не
+            опустели. Опустевшие вычитаемые выбрасываются из рассмотрения.
+         */
+        template <typename Predicate, typename Advance>
+        void advance_heads (Predicate should_advance, Advance advance)
+        {
+            auto heap_end = m_subtrahends.end();
+            while (heap_end != m_subtrahends.begin() && should_advance(m_subtrahends.front()))
+            {
+                std::pop_heap(m_subtrahends.begin(), heap_end, m_heap_order);
+                --heap_end;
+                advance(*heap_end);
+            }
+
+            for (auto range = heap_end; range != m_subtrahends.end(); ++range)
+            {
+                if (not range->empty())
+                {
+                    std::iter_swap(range, heap_end);
+                    ++heap_end;
+                    std::push_heap(m_subtrahends.begin(), heap_end, m_heap_order);
+                }
+            }
+
+            m_subtrahends.advance_end(-std::distance(heap_end, m_subtrahends.end()));
+        }
+
+    private:
+        typename base_type::reference dereference () const
+        {
+            return m_minuend.front();
+        }
+
+        bool equal (const multidifference_iterator & that) const
+        {
+            return std::begin(this->m_minuend) == std::begin(that.m_minuend);
+        }
+
+    private:
+        minuend_range_type m_minuend;
+        subtrahends_range_type m_subtrahends;
+        compare_type m_compare;
+
+        using heap_order_type = detail::front_value_comparator<detail::invert_comparison<Compare>>;
+        heap_order_type m_heap_order;
+    };
+
+    //!     Функция для создания итератора разности с несколькими вычитаемыми с предикатом.
+    /*!
+            Принимает на вход уменьшаемое, набор вычитаемых и операцию, задающую отношение
+        строгого порядка на элементах этих диапазонов.
+            Сами диапазоны должны быть упорядочены относительно этой операции.
+            Возвращает итератор на первый элемент разности.
+     */
+    template <typename ForwardRange, typename RandomAccessRange, typename Compare>
+    auto make_multidifference_iterator (ForwardRange minuend, RandomAccessRange subtrahends, Compare compare)
+    {
+        return
+            multidifference_iterator<ForwardRange, RandomAccessRange, Compare>
+            (
+                std::move(minuend),
+                std::move(subtrahends),
+                compare
+            );
+    }
+
+    //!     Функция для создания итератора разности с несколькими вычитаемыми.
+    /*!
+            Принимает на вход уменьшаемое и набор вычитаемых.
+            Возвращает итератор на первый элемент разности.
+            Отношение порядка для элементов диапазонов выбирается по-умолчанию.
+     */
+    template <typename ForwardRange, typename RandomAccessRange>
+    auto make_multidifference_iterator (ForwardRange minuend, RandomAccessRange subtrahends)
+    {
+        return
+            multidifference_iterator<ForwardRange, RandomAccessRange>
+            (
+                std::move(minuend),
+                std::move(subtrahends)
+            );
+    }
+
+    //!     Функция для создания итератора на конец разности с несколькими вычитаемыми.
+    /*!
+            Принимает на вход итератор на начало разности и индикатор конца итератора.
+            Возвращает итератор-конец, который, если до него дойти, покажет, что элементы разности
+        закончились.
+     */
+    template <typename ForwardRange, typename RandomAccessRange, typename Compare>
+    auto
+        make_multidifference_iterator
+        (
+            const multidifference_iterator<ForwardRange, RandomAccessRange, Compare> & begin,
+            iterator::end_tag_t
+        )
+    {
+        return multidifference_iterator<ForwardRange, RandomAccessRange, Compare>(begin, iterator::end_tag);
+    }
+} // namespace burst
+
+#endif // BURST_ITERATOR_MULTIDIFFERENCE_ITERATOR_HPP
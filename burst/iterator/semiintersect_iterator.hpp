@@ -10,9 +10,8 @@
 #include <boost/algorithm/cxx11/is_sorted.hpp>
 #include <boost/assert.hpp>
 #include <boost/iterator/iterator_facade.hpp>
-#include <boost/range/adaptor/transformed.hpp>
-#include <boost/range/algorithm/count.hpp>
 #include <boost/range/algorithm/remove_if.hpp>
+#include <boost/range/algorithm/sort.hpp>
 #include <boost/range/concepts.hpp>
 
 #include <algorithm>
@@ -51,23 +50,29 @@ namespace burst
 
             Алгоритм работы.
 
-        1. Внешний диапазон переупорядочивается так, что диапазон с M-м по заданному отношению
-           порядка первым элементом всегда стоит на M-м месте, все диапазоны, которые слева от
-           M-го, меньше него по первому элементу, а все, которые справа, — не меньше.
+        1. Внешний диапазон упорядочивается по первым элементам внутренних диапазонов в заданном
+           отношении порядка. Этот порядок поддерживается всё время работы итератора.
         2. Поиск нового полупересечения.
-           а. Каждый диапазон слева от M-го продвигается так, чтобы его первый элемент был не
-              меньше первого элемента M-го диапазона.
-           б. Если диапазон закончился, то он выбрасывается из рассмотрения. Когда диапазонов
+           а. Кандидат полупересечения — это M-й по порядку диапазон ("опорный" диапазон, как в
+              алгоритме WAND).
+           б. Если первый элемент первого диапазона равен первому элементу кандидата, то, в силу
+              упорядоченности, первые M диапазонов равны по первому элементу — полупересечение
+              найдено.
+           в. Иначе первый диапазон заведомо не может дать полупересечения ни на одном из своих
+              элементов, меньших первого элемента кандидата, поэтому он "прокручивается" до
+              первого элемента кандидата, после чего возвращается на своё место в упорядоченном
+              внешнем диапазоне, и цикл повторяется заново.
+           г. Если диапазон закончился, то он выбрасывается из рассмотрения. Когда диапазонов
               становится меньше, чем M, полупересечений больше нет.
-           в. Если текущий диапазон по первому элементу стал больше M-го, то внешний диапазон
-              переупорядочивается в соответствии с п.1, и весь цикл повторяется заново.
-           г. Если текущий диапазон по первому элементу равен M-му диапазону, то берётся следующий
-              диапазон, и т.д.
-           д. Когда первые M диапазонов равны по первому элементу — полупересечение найдено.
-        3. Каждый раз, когда необходимо найти следующий элемент в полупересечении, надо "вывести из
-           равновесия" набор диапазонов, продвинув ровно на один элемент вперёд первые M из них, а
-           также все диапазоны справа от M-го, равные ему по первому элементу, и поддержать
-           инвариант п.1, после чего исполнить п.2.
+        3. Каждый раз, когда необходимо найти следующий элемент в полупересечении, надо продвинуть
+           ровно на один элемент вперёд все диапазоны, первый элемент которых равен текущему
+           полупересечению (а это всегда начало внешнего диапазона), вернуть каждый из них на своё
+           место в упорядоченном внешнем диапазоне, после чего исполнить п.2.
+
+            Каждый шаг поиска обходится в один логарифмический поиск места для продвинутого
+        диапазона и сдвиг не более чем k соседних диапазонов, при этом продвижение диапазонов идёт
+        не по одному элементу, а сразу до ближайшего элемента, который может оказаться в
+        полупересечении.
      */
     template
     <
@@ -128,6 +133,8 @@ namespace burst
                 }));
             BOOST_ASSERT_MSG(min_items > 0, "Невозможно получить полупересечение из нуля элементов.");
 
+            remove_empty_ranges();
+            boost::sort(m_ranges, detail::compare_by_front_value(m_compare));
             settle();
         }
 
@@ -155,19 +162,6 @@ namespace burst
             );
         }
 
-        //!     Поддержать инвариант, необходимый для поиска полупересечений.
-        /*!
-                Подробно инвариант описан в п.1 алгоритма работы.
-         */
-        void maintain_invariant ()
-        {
-            std::nth_element
-            (
-                m_ranges.begin(), semiintersection_candidate(), m_ranges.end(),
-                detail::compare_by_front_value(m_compare)
-            );
-        }
-
         //!     Продвижение к следующему полупересечению.
         /*!
                 Продвигает все диапазоны, установленные на текущем полупересечении (то есть все
@@ -175,152 +169,92 @@ namespace burst
             результате этого пересекаемые диапазоны приходят в такое состояние, что предыдущее
             полупересечение уже недостижимо, а следующее полупересечение в общем случае ещё не
             достигнуто.
+                Продвинутые диапазоны обрабатываются с конца, поэтому каждый из них возвращается
+            на своё место в уже упорядоченную часть внешнего диапазона.
                 Затем запускает процесс поиска нового полупересечения.
          */
         void increment ()
         {
-            std::for_each(m_ranges.begin(), semiintersection_end(),
-                [] (auto & range)
-                {
-                    range.advance_begin(1);
-                });
-
-            settle();
-        }
-
-        //!     Устаканить диапазоны на ближайшем полупересечении.
-        /*!
-                Выбрасывает из рассмотрения пустые диапазоны, и если их осталось не меньше M, то
-            восстанавливает инвариант и запускает функцию поиска нового полупересечения.
-                Если в процессе продвижения закончилось столько диапазонов, что их стало меньше,
-            чем M, то итератор устанавливается на конец полупересечений.
-         */
-        void settle ()
-        {
-            remove_empty_ranges();
-            if (m_ranges.size() >= m_min_items)
-            {
-                maintain_invariant();
-                next_semiintersection();
-            }
-            else
+            auto range = semiintersection_end();
+            while (range != m_ranges.begin())
             {
-                scroll_to_end();
+                --range;
+                range->advance_begin(1);
+                restore_order(range);
             }
-        }
-
-        //!     Получить конец полупересечения.
-        /*!
-                Устанавливает диапазоны справа от кандидата так, что все диапазоны, равные ему по
-            первому элементу, стоят сразу за ним.
-                Возвращает итератор на первый диапазон, первый элемент которого больше первого
-            элемента кандидата.
-         */
-        outer_range_iterator semiintersection_end ()
-        {
-            auto candidate = semiintersection_candidate();
-
-            auto front_values =
-                boost::make_iterator_range(std::next(candidate), m_ranges.end())
-                    | boost::adaptors::transformed([] (const auto & range)
-                        {
-                            return range.front();
-                        });
-
-            auto last_equal_to_candidate = candidate + boost::count(front_values, candidate->front());
-            std::nth_element
-            (
-                candidate, last_equal_to_candidate, m_ranges.end(),
-                detail::compare_by_front_value(m_compare)
-            );
 
-            return std::next(last_equal_to_candidate);
+            settle();
         }
 
-        //!     Поиск нового полупересечения.
+        //!     Устаканить диапазоны на ближайшем полупересечении.
         /*!
                 Устанавливает диапазоны на минимальном из оставшихся элементе, который есть не
             менее, чем в M из рассматриваемых диапазонов.
-                Бежит по внешнему диапазону от первого до кандидата и продвигает каждый из них так,
-            чтобы его первый элемент был не меньше первого элемента кандидата. Если в процессе
-            продвижения какой-либо из диапазонов закончился или стал больше (по первому элементу)
-            кандидата, то диапазоны переупорядочиваются, выбирается новый кандидат, и цикл
-            начинается сначала.
+                Пока первый диапазон по первому элементу меньше кандидата, продвигает его до
+            первого элемента кандидата и возвращает на своё место во внешнем диапазоне.
                 Если слишком много диапазонов закончилось, то есть их стало меньше M, то итератор
             полупересечения устанавливается на конец полупересечений.
          */
-        void next_semiintersection ()
-        {
-            while (not is_end())
-            {
-                auto skipped_until = skip_while_less(m_ranges.begin(), semiintersection_candidate());
-                if (skipped_until == semiintersection_candidate())
-                {
-                    BOOST_ASSERT(not m_compare(skipped_until->front(), semiintersection_candidate()->front()));
-                    BOOST_ASSERT(not m_compare(semiintersection_candidate()->front(), skipped_until->front()));
-                    break; // Полупересечение найдено.
-                }
-                else if (skipped_until->empty())
-                {
-                    drop_empty_range(skipped_until);
-                }
-                else // Текущий диапазон больше кандидата.
-                {
-                    BOOST_ASSERT(m_compare(semiintersection_candidate()->front(), skipped_until->front()));
-                    maintain_invariant();
-                }
-            }
-        }
-
-        //!     Продвинуть диапазоны до кандидата.
-        /*!
-                Пытается продвинуть диапазоны [range, candidate) так, чтобы их первый элемент был
-            не меньше первого элемента диапазона candidate.
-                Если после продвижения некоторый диапазон опустевает, или его первый элемент
-            становится больше первого элемента кандидата, то процесс останавливается и возвращается
-            итератор на этот диапазон.
-         */
-        outer_range_iterator skip_while_less (outer_range_iterator range, outer_range_iterator candidate)
+        void settle ()
         {
-            while (range != candidate)
+            while (m_ranges.size() >= m_min_items)
             {
-                if (m_compare(range->front(), candidate->front()))
+                auto candidate = semiintersection_candidate();
+                auto lagging = m_ranges.begin();
+                if (not m_compare(lagging->front(), candidate->front()))
                 {
-                    skip_to_lower_bound(*range, candidate->front(), m_compare);
-                    if (range->empty() || m_compare(candidate->front(), range->front()))
-                    {
-                        break;
-                    }
+                    return; // Полупересечение найдено.
                 }
 
-                ++range;
+                skip_to_lower_bound(*lagging, candidate->front(), m_compare);
+                restore_order(lagging);
             }
 
-            return range;
+            scroll_to_end();
         }
 
-        //!     Выбросить из рассмотрения опустевший диапазон.
+        //!     Вернуть продвинутый диапазон на своё место.
         /*!
-                Если после удаления этого диапазона их по-прежнему будет достаточно для
-            полупересечения, то нужно удалить диапазон и поддержать инвариант.
-                Если же диапазонов станет меньше необходимого минимума, то итератор полупересечений
-            надо сразу установить на конец полупересечений.
+                Принимает итератор на диапазон, правее которого внешний диапазон упорядочен по
+            первым элементам, причём первый элемент самого диапазона не меньше, чем был до
+            продвижения.
+                Если диапазон опустел, то он выбрасывается из рассмотрения, а иначе сдвигается
+            вправо до своего места так, чтобы упорядоченность внешнего диапазона сохранилась.
          */
-        void drop_empty_range (outer_range_iterator empty_range)
+        void restore_order (outer_range_iterator range)
         {
-            if (m_ranges.size() - 1 >= m_min_items)
+            if (range->empty())
             {
-                std::rotate(empty_range, std::next(empty_range), m_ranges.end());
+                std::rotate(range, std::next(range), m_ranges.end());
                 m_ranges.advance_end(-1);
-
-                maintain_invariant();
             }
             else
             {
-                scroll_to_end();
+                auto place =
+                    std::upper_bound(std::next(range), m_ranges.end(), *range,
+                        detail::compare_by_front_value(m_compare));
+                std::rotate(range, std::next(range), place);
             }
         }
 
+        //!     Получить конец полупересечения.
+        /*!
+                Возвращает итератор на первый диапазон, первый элемент которого больше первого
+            элемента кандидата.
+                Поскольку внешний диапазон упорядочен, все диапазоны, равные кандидату по первому
+            элементу, стоят непрерывно начиная с первого.
+         */
+        outer_range_iterator semiintersection_end ()
+        {
+            auto candidate = semiintersection_candidate();
+            return
+                std::find_if(std::next(candidate), m_ranges.end(),
+                    [this, candidate] (const auto & range)
+                    {
+                        return m_compare(candidate->front(), range.front());
+                    });
+        }
+
         void scroll_to_end ()
         {
             m_ranges = outer_range_type(std::begin(m_ranges), std::begin(m_ranges));
@@ -353,11 +287,6 @@ namespace burst
             return m_ranges.begin() + static_cast<difference_type>(m_min_items - 1);
         }
 
-        bool is_end () const
-        {
-            return m_ranges.empty();
-        }
-
     private:
         outer_range_type m_ranges;
         std::size_t m_min_items;
@@ -0,0 +1,169 @@
+#ifndef BURST_ITERATOR_SYMMETRIC_DIFFERENCE_ITERATOR_HPP
+#define BURST_ITERATOR_SYMMETRIC_DIFFERENCE_ITERATOR_HPP
+
+#include <burst/iterator/detail/front_value_heap.hpp>
+#include <burst/iterator/detail/range_range.hpp>
+#include <burst/iterator/end_tag.hpp>
+
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/optional.hpp>
+
+#include <functional>
+#include <utility>
+
+namespace burst
+{
+    //!     Итератор симметрической разности.
+    /*!
+            Предназначен для нахождения симметрической разности нескольких диапазонов "на лету",
+        то есть без использования дополнительной памяти для хранения результирующего диапазона.
+            Симметрическая разность N множеств — это элементы, которые есть в нечётном количестве
+        из них. При N = 2 это элементы, которые есть ровно в одном из двух множеств.
+            Входные диапазоны рассматриваются как множества: повторы элемента внутри одного
+        диапазона считаются одним вхождением, и каждый элемент симметрической разности выдаётся
+        ровно один раз.
+            Полученный диапазон неизменяем.
+
+        \tparam RandomAccessRange
+            Тип принимаемого на вход внешнего диапазона. Он должен быть диапазоном произвольного
+            доступа, то есть удовлетворять требованиям понятия "Random Access Range".
+        \tparam Compare
+            Бинарная операция, задающая отношение строгого порядка на элементах внутренних
+            диапазонов. Если пользователем явно не указана операция, то, по-умолчанию, берётся
+            отношение "меньше", задаваемое функциональным объектом "std::less<>".
+
+            Алгоритм работы.
+
+        1. Внешний диапазон переупорядочивается в пирамиду по первым элементам внутренних
+           диапазонов, как в итераторе слияния.
+        2. Из пирамиды достаются все диапазоны, начинающиеся с наименьшего элемента, каждый из них
+           "прокручивается" за последнее вхождение этого элемента, и непустые диапазоны кладутся
+           обратно в пирамиду.
+        3. Если таких диапазонов было нечётное количество, то элемент найден, а иначе п.2
+           повторяется.
+     */
+    template
+    <
+        typename RandomAccessRange,
+        typename Compare = std::less<>
+    >
+    class symmetric_difference_iterator:
+        public boost::iterator_facade
+        <
+            symmetric_difference_iterator<RandomAccessRange, Compare>,
+            detail::range_range_value_t<RandomAccessRange>,
+            boost::single_pass_traversal_tag,
+            const detail::range_range_value_t<RandomAccessRange> &
+        >
+    {
+    private:
+        using outer_range_type = RandomAccessRange;
+        using heap_type = detail::front_value_heap<outer_range_type, Compare>;
+
+        using base_type =
+            boost::iterator_facade
+            <
+                symmetric_difference_iterator,
+                detail::range_range_value_t<outer_range_type>,
+                boost::single_pass_traversal_tag,
+                const detail::range_range_value_t<outer_range_type> &
+            >;
+
+    public:
+        explicit symmetric_difference_iterator (outer_range_type ranges, Compare compare = Compare()):
+            m_heap(std::move(ranges), compare),
+            m_current{}
+        {
+            increment();
+        }
+
+        symmetric_difference_iterator (const symmetric_difference_iterator & begin, iterator::end_tag_t):
+            m_heap(begin.m_heap, iterator::end_tag),
+            m_current{}
+        {
+        }
+
+        symmetric_difference_iterator () = default;
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void increment ()
+        {
+            while (not m_heap.empty())
+            {
+                auto value = m_heap.top();
+                auto group = m_heap.pop_group(value);
+                if (group.ranges % 2 == 1)
+                {
+                    m_current.emplace(std::move(value));
+                    return;
+                }
+            }
+
+            m_current = boost::none;
+        }
+
+    private:
+        typename base_type::reference dereference () const
+        {
+            return *m_current;
+        }
+
+        bool equal (const symmetric_difference_iterator & that) const
+        {
+            return
+                static_cast<bool>(this->m_current) == static_cast<bool>(that.m_current) &&
+                this->m_heap == that.m_heap;
+        }
+
+    private:
+        heap_type m_heap;
+        boost::optional<typename base_type::value_type> m_current;
+    };
+
+    //!     Функция для создания итератора симметрической разности с предикатом.
+    /*!
+            Принимает на вход набор диапазонов и операцию, задающую отношение строгого порядка на
+        элементах этих диапазонов.
+            Сами диапазоны должны быть упорядочены относительно этой операции.
+            Возвращает итератор на первый элемент симметрической разности входных диапазонов.
+     */
+    template <typename RandomAccessRange, typename Compare>
+    auto make_symmetric_difference_iterator (RandomAccessRange ranges, Compare compare)
+    {
+        return symmetric_difference_iterator<RandomAccessRange, Compare>(std::move(ranges), compare);
+    }
+
+    //!     Функция для создания итератора симметрической разности.
+    /*!
+            Принимает на вход набор диапазонов.
+            Возвращает итератор на первый элемент симметрической разности входных диапазонов.
+            Отношение порядка для элементов диапазона выбирается по-умолчанию.
+     */
+    template <typename RandomAccessRange>
+    auto make_symmetric_difference_iterator (RandomAccessRange ranges)
+    {
+        return symmetric_difference_iterator<RandomAccessRange>(std::move(ranges));
+    }
+
+    //!     Функция для создания итератора на конец симметрической разности.
+    /*!
+            Принимает на вход итератор на начало симметрической разности и индикатор конца
+        итератора.
+            Возвращает итератор-конец, который, если до него дойти, покажет, что элементы
+        симметрической разности закончились.
+     */
+    template <typename RandomAccessRange, typename Compare>
+    auto
+        make_symmetric_difference_iterator
+        (
+            const symmetric_difference_iterator<RandomAccessRange, Compare> & begin,
+            iterator::end_tag_t
+        )
+    {
+        return symmetric_difference_iterator<RandomAccessRange, Compare>(begin, iterator::end_tag);
+    }
+} // namespace burst
+
+#endif // BURST_ITERATOR_SYMMETRIC_DIFFERENCE_ITERATOR_HPP
@@ -0,0 +1,428 @@
+#ifndef BURST_ITERATOR_WEIGHTED_SEMIINTERSECT_ITERATOR_HPP
+#define BURST_ITERATOR_WEIGHTED_SEMIINTERSECT_ITERATOR_HPP
+
+#include <burst/iterator/detail/front_value_compare.hpp>
+#include <burst/iterator/detail/range_range.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/range/skip_to_lower_bound.hpp>
+
+#include <boost/algorithm/cxx11/all_of.hpp>
+#include <boost/algorithm/cxx11/is_sorted.hpp>
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/concepts.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <utility>
+
+namespace burst
+{
+    //!     Итератор взвешенного полупересечения.
+    /*!
+            Каждому из N входных диапазонов сопоставлен неотрицательный вес. Весом элемента
+        называется сумма весов тех диапазонов, в которых этот элемент есть. Взвешенное
+        полупересечение — это элементы, вес которых не меньше заданного порога.
+            При единичных весах и пороге M взвешенное полупересечение совпадает с обычным
+        полупересечением.
+            Предназначен для взвешенного полупересечения диапазонов "на лету", то есть без
+        использования дополнительной памяти для хранения результирующего диапазона.
+            Входные диапазоны рассматриваются как мультимножества.
+            Значением итератора является пара из элемента и его веса. Полученный диапазон
+        неизменяем.
+            Порог можно поднимать по ходу обхода (см. "raise_threshold" и "raise_threshold_above"),
+        что позволяет отбирать наиболее тяжёлые элементы, пропуская всё больше заведомо
+        неподходящих.
+
+        \tparam RandomAccessRange
+            Тип принимаемого на вход внешнего диапазона. Он должен быть диапазоном произвольного
+            доступа, то есть удовлетворять требованиям понятия "Random Access Range".
+        \tparam RandomAccessWeightRange
+            Тип диапазона весов. Должен быть диапазоном произвольного доступа той же длины, что и
+            внешний диапазон. i-й вес соответствует i-му внутреннему диапазону.
+        \tparam Compare
+            Бинарная операция, задающая отношение строгого порядка на элементах внутренних
+            диапазонов. Если пользователем явно не указана операция, то, по-умолчанию, берётся
+            отношение "меньше", задаваемое функциональным объектом "std::less<>".
+
+            Алгоритм работы (WAND).
+
+        1. Внешний диапазон и диапазон весов совместно упорядочиваются по первым элементам
+           внутренних диапазонов. Этот порядок поддерживается всё время работы итератора.
+        2. Поиск нового элемента.
+           а. Веса диапазонов накапливаются по порядку до тех пор, пока их сумма не достигнет
+              порога. Диапазон, на котором это произошло, называется опорным.
+           б. Если опорного диапазона нет, то ни один из оставшихся элементов не может набрать
+              нужный вес, и итератор устанавливается на конец.
+           в. Если первый элемент первого диапазона равен первому элементу опорного, то элемент
+              найден, а его вес — это сумма весов всех диапазонов, начинающихся с него.
+           г. Иначе первый диапазон "прокручивается" до первого элемента опорного диапазона (все
+              элементы до него не могут набрать нужный вес), возвращается на своё место во
+              внешнем диапазоне, и цикл повторяется.
+           д. Опустевшие диапазоны выбрасываются из рассмотрения вместе со своими весами.
+        3. Для перехода к следующему элементу все диапазоны, начинающиеся с текущего элемента,
+           продвигаются на один элемент вперёд и возвращаются на свои места, после чего
+           исполняется п.2.
+     */
+    template
+    <
+        typename RandomAccessRange,
+        typename RandomAccessWeightRange,
+        typename Compare = std::less<>
+    >
+    class weighted_semiintersect_iterator:
+        public boost::iterator_facade
+        <
+            weighted_semiintersect_iterator<RandomAccessRange, RandomAccessWeightRange, Compare>,
+            std::pair
+            <
+                detail::range_range_value_t<RandomAccessRange>,
+                typename boost::range_value<RandomAccessWeightRange>::type
+            >,
+            boost::single_pass_traversal_tag,
+            std::pair
+            <
+                detail::range_range_value_t<RandomAccessRange>,
+                typename boost::range_value<RandomAccessWeightRange>::type
+            >
+        >
+    {
+    private:
+        using outer_range_type = RandomAccessRange;
+        BOOST_CONCEPT_ASSERT((boost::RandomAccessRangeConcept<outer_range_type>));
+
+        using inner_range_type = typename boost::range_value<outer_range_type>::type;
+        BOOST_CONCEPT_ASSERT((boost::ForwardRangeConcept<inner_range_type>));
+
+        using weight_range_type = RandomAccessWeightRange;
+        BOOST_CONCEPT_ASSERT((boost::RandomAccessRangeConcept<weight_range_type>));
+
+        using compare_type = Compare;
+
+        using outer_range_iterator = typename boost::range_iterator<outer_range_type>::type;
+        using weight_range_iterator = typename boost::range_iterator<weight_range_type>::type;
+
+        using base_type =
+            boost::iterator_facade
+            <
+                weighted_semiintersect_iterator,
+                std::pair
+                <
+                    detail::range_range_value_t<RandomAccessRange>,
+                    typename boost::range_value<RandomAccessWeightRange>::type
+                >,
+                boost::single_pass_traversal_tag,
+                std::pair
+                <
+                    detail::range_range_value_t<RandomAccessRange>,
+                    typename boost::range_value<RandomAccessWeightRange>::type
+                >
+            >;
+
+    public:
+        using weight_type = typename boost::range_value<weight_range_type>::type;
+
+        weighted_semiintersect_iterator
+            (
+                outer_range_type ranges,
+                weight_range_type weights,
+                weight_type threshold,
+                Compare compare = Compare()
+            ):
+            m_ranges(std::move(ranges)),
+            m_weights(std::move(weights)),
+            m_threshold(threshold),
+            m_threshold_is_strict(false),
+            m_weight{},
+            m_compare(compare)
+        {
+            BOOST_ASSERT(m_ranges.size() == m_weights.size());
+            BOOST_ASSERT(boost::algorithm::all_of(m_ranges,
+                [this] (const auto & range)
+                {
+                    return boost::algorithm::is_sorted(range, m_compare);
+                }));
+            BOOST_ASSERT(boost::algorithm::all_of(m_weights,
+                [] (const auto & weight)
+                {
+                    return not (weight < weight_type{});
+                }));
+
+            auto range = m_ranges.end();
+            while (range != m_ranges.begin())
+            {
+                --range;
+                restore_order(range);
+            }
+
+            settle();
+        }
+
+        weighted_semiintersect_iterator (const weighted_semiintersect_iterator & begin, iterator::end_tag_t):
+            m_ranges(std::begin(begin.m_ranges), std::begin(begin.m_ranges)),
+            m_weights(std::begin(begin.m_weights), std::begin(begin.m_weights)),
+            m_threshold(begin.m_threshold),
+            m_threshold_is_strict(begin.m_threshold_is_strict),
+            m_weight{},
+            m_compare(begin.m_compare)
+        {
+        }
+
+        weighted_semiintersect_iterator () = default;
+
+        //!     Поднять порог.
+        /*!
+                Новый порог не может быть ниже текущего. Текущий элемент остаётся на месте, а
+            следующие элементы будут отбираться уже с учётом нового порога.
+         */
+        void raise_threshold (weight_type threshold)
+        {
+            BOOST_ASSERT(m_threshold_is_strict ? m_threshold < threshold : not (threshold < m_threshold));
+            m_threshold = threshold;
+            m_threshold_is_strict = false;
+        }
+
+        //!     Поднять порог так, чтобы элементы с весом, равным порогу, пропускались.
+        /*!
+                Новый порог не может быть ниже текущего. После этого отбираются только элементы,
+            вес которых строго больше порога. Нужно, когда элементы с весом, равным порогу, уже не
+            интересны (например, при отборе наиболее тяжёлых элементов, когда порог равен весу
+            самого лёгкого из уже отобранных): тогда они не только не выдаются, но и участвуют в
+            пропуске участков диапазонов наравне с более лёгкими элементами.
+         */
+        void raise_threshold_above (weight_type threshold)
+        {
+            BOOST_ASSERT(not (threshold < m_threshold));
+            m_threshold = threshold;
+            m_threshold_is_strict = true;
+        }
+
+        const weight_type & threshold () const
+        {
+            return m_threshold;
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        void increment ()
+        {
+            auto range = current_end();
+            while (range != m_ranges.begin())
+            {
+                --range;
+                range->advance_begin(1);
+                restore_order(range);
+            }
+
+            settle();
+        }
+
+        //!     Устаканить диапазоны на ближайшем элементе, вес которого не меньше порога.
+        /*!
+                Подробно процесс описан в п.2 алгоритма работы.
+         */
+        void settle ()
+        {
+            auto pivot = find_pivot();
+            while (pivot != m_ranges.end())
+            {
+                auto lagging = m_ranges.begin();
+                if (not m_compare(lagging->front(), pivot->front()))
+                {
+                    m_weight = current_weight();
+                    return;
+                }
+
+                skip_to_lower_bound(*lagging, pivot->front(), m_compare);
+                restore_order(lagging);
+                pivot = find_pivot();
+            }
+
+            scroll_to_end();
+        }
+
+        //!     Найти опорный диапазон.
+        /*!
+                Возвращает итератор на первый диапазон, на котором накопленная сумма весов
+            достигает порога (а если порог строгий, то превышает его), или конец внешнего
+            диапазона, если такого диапазона нет.
+         */
+        outer_range_iterator find_pivot () const
+        {
+            auto accumulated = weight_type{};
+            auto weight = m_weights.begin();
+            for (auto range = m_ranges.begin(); range != m_ranges.end(); ++range, ++weight)
+            {
+                accumulated += *weight;
+                if (reaches_threshold(accumulated))
+                {
+                    return range;
+                }
+            }
+
+            return m_ranges.end();
+        }
+
+        bool reaches_threshold (const weight_type & weight) const
+        {
+            return m_threshold_is_strict ? m_threshold < weight : not (weight < m_threshold);
+        }
+
+        //!     Конец набора диапазонов, начинающихся с текущего элемента.
+        outer_range_iterator current_end () const
+        {
+            const auto & current = m_ranges.front().front();
+            return
+                std::find_if(std::next(m_ranges.begin()), m_ranges.end(),
+                    [this, & current] (const auto & range)
+                    {
+                        return m_compare(current, range.front());
+                    });
+        }
+
+        //!     Вес текущего элемента.
+        weight_type current_weight () const
+        {
+            auto end = std::next(m_weights.begin(), std::distance(m_ranges.begin(), current_end()));
+            return std::accumulate(m_weights.begin(), end, weight_type{});
+        }
+
+        weight_range_iterator weight_of (outer_range_iterator range) const
+        {
+            return std::next(m_weights.begin(), std::distance(m_ranges.begin(), range));
+        }
+
+        //!     Вернуть продвинутый диапазон на своё место.
+        /*!
+                Принимает итератор на диапазон, правее которого внешний диапазон упорядочен по
+            первым элементам.
+                Если диапазон опустел, то он выбрасывается из рассмотрения вместе со своим весом, а
+            иначе сдвигается вправо до своего места. Вес диапазона сдвигается вместе с ним.
+         */
+        void restore_order (outer_range_iterator range)
+        {
+            auto weight = weight_of(range);
+            if (range->empty())
+            {
+                std::rotate(range, std::next(range), m_ranges.end());
+                std::rotate(weight, std::next(weight), m_weights.end());
+                m_ranges.advance_end(-1);
+                m_weights.advance_end(-1);
+            }
+            else
+            {
+                auto place =
+                    std::upper_bound(std::next(range), m_ranges.end(), *range,
+                        detail::compare_by_front_value(m_compare));
+                std::rotate(range, std::next(range), place);
+                std::rotate(weight, std::next(weight), weight_of(place));
+            }
+        }
+
+        void scroll_to_end ()
+        {
+            m_ranges = outer_range_type(std::begin(m_ranges), std::begin(m_ranges));
+            m_weights = weight_range_type(std::begin(m_weights), std::begin(m_weights));
+        }
+
+    private:
+        typename base_type::reference dereference () const
+        {
+            return {m_ranges.front().front(), m_weight};
+        }
+
+        bool equal (const weighted_semiintersect_iterator & that) const
+        {
+            return this->m_ranges == that.m_ranges;
+        }
+
+    private:
+        outer_range_type m_ranges;
+        weight_range_type m_weights;
+        weight_type m_threshold;
+        // Должен ли вес выдаваемых элементов быть строго больше порога.
+        bool m_threshold_is_strict;
+        weight_type m_weight;
+        compare_type m_compare;
+    };
+
+    //!     Функция для создания итератора взвешенного полупересечения с предикатом.
+    /*!
+            Принимает на вход набор диапазонов, набор их весов, порог и операцию, задающую
+        отношение строгого порядка на элементах диапазонов.
+            Сами диапазоны должны быть упорядочены относительно этой операции.
+            Возвращает итератор на первый элемент, вес которого не меньше порога.
+     */
+    template <typename RandomAccessRange, typename RandomAccessWeightRange, typename Weight, typename Compare>
+    auto
+        make_weighted_semiintersect_iterator
+        (
+            RandomAccessRange ranges,
+            RandomAccessWeightRange weights,
+            Weight threshold,
+            Compare compare
+        )
+    {
+        return
+            weighted_semiintersect_iterator<RandomAccessRange, RandomAccessWeightRange, Compare>
+            (
+                std::move(ranges),
+                std::move(weights),
+                threshold,
+                compare
+            );
+    }
+
+    //!     Функция для создания итератора взвешенного полупересечения.
+    /*!
+            Принимает на вход набор диапазонов, набор их весов и порог.
+            Возвращает итератор на первый элемент, вес которого не меньше порога.
+            Отношение порядка для элементов диапазона выбирается по-умолчанию.
+     */
+    template <typename RandomAccessRange, typename RandomAccessWeightRange, typename Weight>
+    auto
+        make_weighted_semiintersect_iterator
+        (
+            RandomAccessRange ranges,
+            RandomAccessWeightRange weights,
+            Weight threshold
+        )
+    {
+        return
+            weighted_semiintersect_iterator<RandomAccessRange, RandomAccessWeightRange>
+            (
+                std::move(ranges),
+                std::move(weights),
+                threshold
+            );
+    }
+
+    //!     Функция для создания итератора на конец взвешенного полупересечения.
+    /*!
+            Принимает на вход итератор на начало взвешенного полупересечения и индикатор конца
+        итератора.
+            Возвращает итератор-конец, который, если до него дойти, покажет, что элементы
+        взвешенного полупересечения закончились.
+     */
+    template <typename RandomAccessRange, typename RandomAccessWeightRange, typename Compare>
+    auto
+        make_weighted_semiintersect_iterator
+        (
+            const weighted_semiintersect_iterator<RandomAccessRange, RandomAccessWeightRange, Compare> & begin,
+            iterator::end_tag_t
+        )
+    {
+        return
+            weighted_semiintersect_iterator<RandomAccessRange, RandomAccessWeightRange, Compare>
+            (
+                begin,
+                iterator::end_tag
+            );
+    }
+} // namespace burst
+
+#endif // BURST_ITERATOR_WEIGHTED_SEMIINTERSECT_ITERATOR_HPP
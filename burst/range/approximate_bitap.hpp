@@ -0,0 +1,46 @@
+#ifndef BURST_RANGE_APPROXIMATE_BITAP_HPP
+#define BURST_RANGE_APPROXIMATE_BITAP_HPP
+
+#include <burst/iterator/approximate_bitap_iterator.hpp>
+#include <burst/iterator/end_tag.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <cstddef>
+
+namespace burst
+{
+    //!     Функция для создания диапазона приближённых вхождений образца в текст.
+    /*!
+            Принимает образец, допустимое количество ошибок и текст.
+            Возвращает диапазон, каждый элемент которого — это algorithm::approximate_match:
+        место в тексте, где кончается вхождение образца с не более чем заданным количеством
+        ошибок, и наименьшее количество ошибок этого вхождения. Ошибки считаются по Левенштейну.
+     */
+    template <typename Bitmask, typename ForwardRange1, typename ForwardRange2>
+    auto approximate_bitap (const ForwardRange1 & pattern, std::size_t errors, const ForwardRange2 & text)
+    {
+        auto bitap = algorithm::make_approximate_bitap<Bitmask>(pattern, errors);
+        auto begin = make_approximate_bitap_iterator(std::move(bitap), text);
+        auto end = make_approximate_bitap_iterator(begin, iterator::end_tag);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+
+    //!     Функция для создания диапазона приближённых вхождений с заданной мерой ошибок.
+    /*!
+            Принимает явный аргумент шаблона "Distance" — algorithm::hamming_distance или
+        algorithm::levenshtein_distance.
+     */
+    template <typename Bitmask, typename Distance, typename ForwardRange1, typename ForwardRange2>
+    auto approximate_bitap (const ForwardRange1 & pattern, std::size_t errors, const ForwardRange2 & text)
+    {
+        auto bitap = algorithm::make_approximate_bitap<Bitmask, Distance>(pattern, errors);
+        auto begin = make_approximate_bitap_iterator(std::move(bitap), text);
+        auto end = make_approximate_bitap_iterator(begin, iterator::end_tag);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+}
+
+#endif // BURST_RANGE_APPROXIMATE_BITAP_HPP
@@ -0,0 +1,45 @@
+#ifndef BURST_RANGE_MERGE_COUNTED_HPP
+#define BURST_RANGE_MERGE_COUNTED_HPP
+
+#include <burst/iterator/counted_merge_iterator.hpp>
+#include <burst/iterator/end_tag.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+namespace burst
+{
+    //!     Функция для создания диапазона слияния с подсчётом с предикатом.
+    /*!
+            Принимает на вход диапазон диапазонов, которые нужно слить, и операцию, задающую
+        отношение строгого порядка на элементах этих диапазонов. При этом сами диапазоны тоже
+        должны быть упорядочены относительно этой операции.
+            Возвращает упорядоченный относительно всё той же операции диапазон пар, в каждой из
+        которых элемент и количество его вхождений во все входные диапазоны.
+     */
+    template <typename RandomAccessRange, typename Compare>
+    auto merge_counted (RandomAccessRange ranges, Compare compare)
+    {
+        auto begin = make_counted_merge_iterator(std::move(ranges), compare);
+        auto end = make_counted_merge_iterator(begin, iterator::end_tag);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+
+    //!     Функция для создания диапазона слияния с подсчётом.
+    /*!
+            Принимает на вход диапазон диапазонов, которые нужно слить.
+            Возвращает диапазон пар из элемента и количества его вхождений во все входные
+        диапазоны.
+            Отношение порядка выбирается по-умолчанию.
+     */
+    template <typename RandomAccessRange>
+    auto merge_counted (RandomAccessRange ranges)
+    {
+        auto begin = make_counted_merge_iterator(std::move(ranges));
+        auto end = make_counted_merge_iterator(begin, iterator::end_tag);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+}
+
+#endif // BURST_RANGE_MERGE_COUNTED_HPP
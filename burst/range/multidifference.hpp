@@ -0,0 +1,55 @@
+#ifndef BURST_RANGE_MULTIDIFFERENCE_HPP
+#define BURST_RANGE_MULTIDIFFERENCE_HPP
+
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/multidifference_iterator.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+namespace burst
+{
+    //!     Функция для создания разности диапазона и объединения нескольких диапазонов с предикатом.
+    /*!
+            Принимает на вход уменьшаемое, набор вычитаемых и отношение строгого порядка на
+        элементах этих диапазонов. При этом сами диапазоны тоже должны быть упорядочены
+        относительно этой операции.
+            Возвращает диапазон, упорядоченный относительно всё той же операции, каждый элемент
+        которого одновременно есть в уменьшаемом и отсутствует в каждом из вычитаемых.
+     */
+    template <typename ForwardRange, typename RandomAccessRange, typename Compare>
+    auto multidifference (ForwardRange minuend, RandomAccessRange && subtrahends, Compare compare)
+    {
+        auto begin =
+            make_multidifference_iterator
+            (
+                std::move(minuend),
+                std::forward<RandomAccessRange>(subtrahends),
+                compare
+            );
+        auto end = make_multidifference_iterator(begin, iterator::end_tag);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+
+    //!     Функция для создания разности диапазона и объединения нескольких диапазонов.
+    /*!
+            Принимает на вход уменьшаемое и набор вычитаемых.
+            Возвращает разность уменьшаемого и объединения вычитаемых.
+            Отношение порядка выбирается по-умолчанию.
+     */
+    template <typename ForwardRange, typename RandomAccessRange>
+    auto multidifference (ForwardRange minuend, RandomAccessRange && subtrahends)
+    {
+        auto begin =
+            make_multidifference_iterator
+            (
+                std::move(minuend),
+                std::forward<RandomAccessRange>(subtrahends)
+            );
+        auto end = make_multidifference_iterator(begin, iterator::end_tag);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+}
+
+#endif // BURST_RANGE_MULTIDIFFERENCE_HPP
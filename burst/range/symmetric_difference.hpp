@@ -0,0 +1,44 @@
+#ifndef BURST_RANGE_SYMMETRIC_DIFFERENCE_HPP
+#define BURST_RANGE_SYMMETRIC_DIFFERENCE_HPP
+
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/symmetric_difference_iterator.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+namespace burst
+{
+    //!     Функция для создания симметрической разности диапазонов с предикатом.
+    /*!
+            Принимает на вход набор диапазонов и операцию, задающую отношение строгого порядка на
+        элементах этих диапазонов. При этом сами диапазоны тоже должны быть упорядочены
+        относительно этой операции.
+            Возвращает упорядоченный относительно всё той же операции диапазон элементов, которые
+        есть в нечётном количестве входных диапазонов.
+     */
+    template <typename RandomAccessRange, typename Compare>
+    auto symmetric_difference (RandomAccessRange ranges, Compare compare)
+    {
+        auto begin = make_symmetric_difference_iterator(std::move(ranges), compare);
+        auto end = make_symmetric_difference_iterator(begin, iterator::end_tag);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+
+    //!     Функция для создания симметрической разности диапазонов.
+    /*!
+            Принимает на вход набор диапазонов.
+            Возвращает диапазон элементов, которые есть в нечётном количестве входных диапазонов.
+            Отношение порядка выбирается по-умолчанию.
+     */
+    template <typename RandomAccessRange>
+    auto symmetric_difference (RandomAccessRange ranges)
+    {
+        auto begin = make_symmetric_difference_iterator(std::move(ranges));
+        auto end = make_symmetric_difference_iterator(begin, iterator::end_tag);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+}
+
+#endif // BURST_RANGE_SYMMETRIC_DIFFERENCE_HPP
@@ -0,0 +1,72 @@
+#ifndef BURST_RANGE_WEIGHTED_SEMIINTERSECT_HPP
+#define BURST_RANGE_WEIGHTED_SEMIINTERSECT_HPP
+
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/weighted_semiintersect_iterator.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+namespace burst
+{
+    //!     Функция для создания диапазона взвешенного полупересечения с предикатом.
+    /*!
+            Принимает на вход набор диапазонов, набор их весов, порог и операцию, задающую
+        отношение строгого порядка на элементах диапазонов. При этом сами диапазоны тоже должны
+        быть упорядочены относительно этой операции.
+            Возвращает упорядоченный относительно всё той же операции диапазон пар из элемента и
+        его веса, то есть суммы весов диапазонов, в которых этот элемент есть. В результат
+        попадают только те элементы, вес которых не меньше порога.
+     */
+    template <typename RandomAccessRange, typename RandomAccessWeightRange, typename Weight, typename Compare>
+    auto
+        weighted_semiintersect
+        (
+            RandomAccessRange && ranges,
+            RandomAccessWeightRange && weights,
+            Weight threshold,
+            Compare compare
+        )
+    {
+        auto begin =
+            make_weighted_semiintersect_iterator
+            (
+                std::forward<RandomAccessRange>(ranges),
+                std::forward<RandomAccessWeightRange>(weights),
+                threshold,
+                compare
+            );
+        auto end = make_weighted_semiintersect_iterator(begin, iterator::end_tag);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+
+    //!     Функция для создания диапазона взвешенного полупересечения.
+    /*!
+            Принимает на вход набор диапазонов, набор их весов и порог.
+            Возвращает диапазон пар из элемента и его веса для всех элементов, вес которых не
+        меньше порога.
+            Отношение порядка выбирается по-умолчанию.
+     */
+    template <typename RandomAccessRange, typename RandomAccessWeightRange, typename Weight>
+    auto
+        weighted_semiintersect
+        (
+            RandomAccessRange && ranges,
+            RandomAccessWeightRange && weights,
+            Weight threshold
+        )
+    {
+        auto begin =
+            make_weighted_semiintersect_iterator
+            (
+                std::forward<RandomAccessRange>(ranges),
+                std::forward<RandomAccessWeightRange>(weights),
+                threshold
+            );
+        auto end = make_weighted_semiintersect_iterator(begin, iterator::end_tag);
+
+        return boost::make_iterator_range(std::move(begin), std::move(end));
+    }
+}
+
+#endif // BURST_RANGE_WEIGHTED_SEMIINTERSECT_HPP
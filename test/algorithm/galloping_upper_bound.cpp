@@ -2,7 +2,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <list>
 #include <string>
 #include <vector>
@@ -74,4 +76,43 @@ BOOST_AUTO_TEST_SUITE(galloping_upper_bound)
         BOOST_CHECK(search_result == range.begin() + 3);
         BOOST_CHECK_EQUAL(*search_result, 20);
     }
+
+    BOOST_AUTO_TEST_CASE(integral_search_agrees_with_std_upper_bound)
+    {
+        for (std::size_t size = 0; size < 400; size += 7)
+        {
+            std::vector<std::uint64_t> range(size);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                range[i] = i / 3 * 2;
+            }
+
+            for (std::uint64_t value = 0; value < size + 3; ++value)
+            {
+                BOOST_CHECK
+                (
+                    burst::galloping_upper_bound(range.begin(), range.end(), value) ==
+                        std::upper_bound(range.begin(), range.end(), value)
+                );
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(integral_search_handles_extreme_values)
+    {
+        const std::int32_t min = std::numeric_limits<std::int32_t>::min();
+        const std::int32_t max = std::numeric_limits<std::int32_t>::max();
+        std::vector<std::int32_t> range(50, min);
+        range.resize(100, 0);
+        range.resize(150, max);
+
+        for (auto value: {min, -1, 0, 1, max})
+        {
+            BOOST_CHECK
+            (
+                burst::galloping_upper_bound(range.data(), range.data() + range.size(), value) ==
+                    std::upper_bound(range.data(), range.data() + range.size(), value)
+            );
+        }
+    }
 BOOST_AUTO_TEST_SUITE_END()
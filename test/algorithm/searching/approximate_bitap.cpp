@@ -0,0 +1,218 @@
+#include <burst/algorithm/searching/approximate_bitap.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Наименьшее расстояние Левенштейна от образца до подстрок текста, оканчивающихся на каждом
+    // месте текста (алгоритм Селлерса).
+    std::vector<std::size_t> levenshtein_ends (const std::string & pattern, const std::string & text)
+    {
+        std::vector<std::size_t> column(pattern.size() + 1);
+        for (std::size_t i = 0; i <= pattern.size(); ++i)
+        {
+            column[i] = i;
+        }
+
+        std::vector<std::size_t> ends;
+        for (auto element: text)
+        {
+            auto diagonal = column[0];
+            column[0] = 0;
+            for (std::size_t i = 1; i <= pattern.size(); ++i)
+            {
+                const auto above = column[i];
+                column[i] = std::min({above + 1, column[i - 1] + 1, diagonal + (pattern[i - 1] == element ? 0u : 1u)});
+                diagonal = above;
+            }
+            ends.push_back(column.back());
+        }
+        return ends;
+    }
+
+    std::vector<std::size_t> hamming_ends (const std::string & pattern, const std::string & text)
+    {
+        std::vector<std::size_t> ends;
+        for (std::size_t end = 1; end <= text.size(); ++end)
+        {
+            if (end < pattern.size())
+            {
+                ends.push_back(pattern.size() + 1);
+            }
+            else
+            {
+                const auto start = end - pattern.size();
+                std::size_t mismatches = 0;
+                for (std::size_t i = 0; i < pattern.size(); ++i)
+                {
+                    mismatches += pattern[i] != text[start + i];
+                }
+                ends.push_back(mismatches);
+            }
+        }
+        return ends;
+    }
+
+    template <typename Searcher>
+    std::vector<std::size_t> searched_ends (const Searcher & searcher, const std::string & text)
+    {
+        std::vector<std::size_t> ends(text.size(), searcher.errors() + 1);
+
+        typename Searcher::state_type state;
+        auto match = searcher.find_first(text.begin(), text.end(), state);
+        while (not match.range.empty())
+        {
+            ends[static_cast<std::size_t>(match.range.end() - text.begin()) - 1] = match.errors;
+            match = searcher.find_next(match, text.end(), state);
+        }
+        return ends;
+    }
+
+    std::vector<std::size_t> clip (std::vector<std::size_t> ends, std::size_t errors)
+    {
+        for (auto & end: ends)
+        {
+            end = std::min(end, errors + 1);
+        }
+        return ends;
+    }
+
+    std::string random_string (std::default_random_engine & engine, std::size_t size)
+    {
+        std::uniform_int_distribution<int> letter('a', 'c');
+        std::string result(size, 'a');
+        for (auto & element: result)
+        {
+            element = static_cast<char>(letter(engine));
+        }
+        return result;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(approximate_bitap)
+    BOOST_AUTO_TEST_CASE(search_without_errors_finds_exact_match)
+    {
+        const std::string pattern("шаблон");
+        const std::string text("какой-то шаблон");
+
+        const auto search = burst::algorithm::make_approximate_bitap<std::uint64_t>(pattern, 0);
+        const auto match = search(text.begin(), text.end());
+
+        BOOST_CHECK(match.range.begin() == text.end() - static_cast<std::ptrdiff_t>(pattern.size()));
+        BOOST_CHECK(match.range.end() == text.end());
+        BOOST_CHECK_EQUAL(match.errors, 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(hamming_match_is_a_range_of_pattern_length_with_mismatches_counted)
+    {
+        const std::string pattern("identifier");
+        const std::string text("some idantifyer here");
+
+        const auto search =
+            burst::algorithm::make_approximate_bitap<std::uint16_t, burst::algorithm::hamming_distance>(pattern, 2);
+        const auto match = search(text.begin(), text.end());
+
+        BOOST_CHECK_EQUAL(std::string(match.range.begin(), match.range.end()), "idantifyer");
+        BOOST_CHECK_EQUAL(match.errors, 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(hamming_distance_does_not_allow_insertions_and_deletions)
+    {
+        const std::string pattern("abcdef");
+        const std::string text("xxabdefxxabcxdefxx");
+
+        const auto search =
+            burst::algorithm::make_approximate_bitap<std::uint8_t, burst::algorithm::hamming_distance>(pattern, 1);
+        const auto match = search(text.begin(), text.end());
+
+        BOOST_CHECK(match.range.empty());
+        BOOST_CHECK(match.range.begin() == text.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(levenshtein_distance_allows_insertions_and_deletions)
+    {
+        const std::string pattern("abcdef");
+
+        const auto search = burst::algorithm::make_approximate_bitap<std::uint8_t>(pattern, 1);
+
+        const std::string deleted("xxabdefxx");
+        const auto deletion = search(deleted.begin(), deleted.end());
+        BOOST_CHECK(deletion.range.end() == deleted.begin() + 7);
+        BOOST_CHECK_EQUAL(deletion.errors, 1);
+
+        const std::string inserted("xxabcxdefxx");
+        const auto insertion = search(inserted.begin(), inserted.end());
+        BOOST_CHECK(insertion.range.end() == inserted.begin() + 9);
+        BOOST_CHECK_EQUAL(insertion.errors, 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(levenshtein_search_agrees_with_dynamic_programming)
+    {
+        std::default_random_engine engine;
+        for (std::size_t pattern_size = 1; pattern_size <= 12; ++pattern_size)
+        {
+            const auto pattern = random_string(engine, pattern_size);
+            const auto text = random_string(engine, 200);
+            for (std::size_t errors = 0; errors < pattern_size && errors <= 4; ++errors)
+            {
+                const auto search = burst::algorithm::make_approximate_bitap<std::uint16_t>(pattern, errors);
+
+                const auto expected = clip(levenshtein_ends(pattern, text), errors);
+                const auto actual = searched_ends(search, text);
+                BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(hamming_search_agrees_with_direct_comparison)
+    {
+        std::default_random_engine engine;
+        for (std::size_t pattern_size = 1; pattern_size <= 12; ++pattern_size)
+        {
+            const auto pattern = random_string(engine, pattern_size);
+            const auto text = random_string(engine, 200);
+            for (std::size_t errors = 0; errors < pattern_size && errors <= 4; ++errors)
+            {
+                const auto search =
+                    burst::algorithm::make_approximate_bitap<std::bitset<16>, burst::algorithm::hamming_distance>(pattern, errors);
+
+                const auto expected = clip(hamming_ends(pattern, text), errors);
+                const auto actual = searched_ends(search, text);
+                BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(patterns_longer_than_a_machine_word_are_found_with_bitset)
+    {
+        const std::string pattern(std::string(80, 'a') + "bc");
+        const std::string text(std::string(90, 'a') + "bd");
+
+        const auto search = burst::algorithm::make_approximate_bitap<std::bitset<128>, burst::algorithm::hamming_distance>(pattern, 1);
+        const auto match = search(text.begin(), text.end());
+
+        BOOST_CHECK(match.range.end() == text.end());
+        BOOST_CHECK_EQUAL(match.errors, 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(search_works_with_arbitrary_map)
+    {
+        const std::vector<int> pattern{10, 20, 30, 40};
+        const std::vector<int> text{1, 10, 20, 35, 40, 2};
+
+        const burst::algorithm::approximate_bitap<int, std::uint32_t, burst::algorithm::hamming_distance> search(pattern, 1);
+        const auto match = search(text.begin(), text.end());
+
+        BOOST_CHECK(match.range.begin() == text.begin() + 1);
+        BOOST_CHECK(match.range.end() == text.begin() + 5);
+        BOOST_CHECK_EQUAL(match.errors, 1);
+    }
+BOOST_AUTO_TEST_SUITE_END()
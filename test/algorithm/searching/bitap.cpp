@@ -2,11 +2,58 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <bitset>
+#include <cstddef>
+#include <cstdint>
 #include <forward_list>
+#include <random>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(bitap)
+    BOOST_AUTO_TEST_CASE(patterns_longer_than_a_machine_word_are_found_with_bitset)
+    {
+        std::default_random_engine engine;
+        std::uniform_int_distribution<int> letter('a', 'b');
+        const auto random_string =
+            [& engine, & letter] (std::size_t size)
+            {
+                std::string result(size, 'a');
+                for (auto & element: result)
+                {
+                    element = static_cast<char>(letter(engine));
+                }
+                return result;
+            };
+
+        for (auto pattern_size: {1ul, 63ul, 64ul, 65ul, 100ul, 200ul, 256ul})
+        {
+            const auto pattern = random_string(pattern_size);
+            auto text = random_string(3000);
+            text.replace(1000, pattern.size(), pattern);
+            text.replace(2500, pattern.size(), pattern);
+
+            const burst::algorithm::bitap<char, std::bitset<256>> search(pattern);
+
+            auto expected = text.begin();
+            auto found = text.begin();
+            while (true)
+            {
+                expected = std::search(expected, text.end(), pattern.begin(), pattern.end());
+                found = search(found, text.end());
+                BOOST_REQUIRE(found == expected);
+                if (found == text.end())
+                {
+                    break;
+                }
+                ++expected;
+                ++found;
+            }
+        }
+    }
+
     BOOST_AUTO_TEST_CASE(pattern_is_found_at_the_next_match_when_search_started_in_the_middle_of_the_first_match)
     {
         std::string pattern("asdf");
@@ -19,4 +66,32 @@ BOOST_AUTO_TEST_SUITE(bitap)
         difference_type repeat_offset = static_cast<difference_type>(pattern.size());
         BOOST_CHECK(match_position == text.begin() + repeat_offset);
     }
+
+    BOOST_AUTO_TEST_CASE(wide_integer_tokens_are_found_with_default_flat_table)
+    {
+        std::default_random_engine engine;
+        std::uniform_int_distribution<std::uint32_t> token(0, 50);
+
+        std::vector<std::uint32_t> text(5000);
+        std::generate(text.begin(), text.end(), [&] { return token(engine) * 100003u; });
+        const std::vector<std::uint32_t> pattern(text.begin() + 1000, text.begin() + 1003);
+
+        const auto search = burst::algorithm::make_bitap<std::uint64_t>(pattern);
+        static_assert(std::is_same<decltype(search)::map_type, burst::algorithm::flat_bitmask_map<std::uint32_t, std::uint64_t>>::value, "");
+
+        auto expected = text.begin();
+        auto found = text.begin();
+        while (true)
+        {
+            expected = std::search(expected, text.end(), pattern.begin(), pattern.end());
+            found = search(found, text.end());
+            BOOST_REQUIRE(found == expected);
+            if (found == text.end())
+            {
+                break;
+            }
+            ++expected;
+            ++found;
+        }
+    }
 BOOST_AUTO_TEST_SUITE_END()
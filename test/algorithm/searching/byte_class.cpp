@@ -0,0 +1,200 @@
+#include <burst/algorithm/searching/approximate_bitap.hpp>
+#include <burst/algorithm/searching/bitap.hpp>
+#include <burst/algorithm/searching/byte_class.hpp>
+#include <burst/algorithm/searching/multi_bitap.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Наивный поиск: пробует каждое место текста и сравнивает элементы с классами образца.
+    std::string::const_iterator
+        naive_search
+        (
+            std::string::const_iterator first,
+            std::string::const_iterator last,
+            const std::vector<burst::algorithm::byte_class> & pattern
+        )
+    {
+        for (; static_cast<std::size_t>(last - first) >= pattern.size(); ++first)
+        {
+            std::size_t matched = 0;
+            while (matched < pattern.size() && pattern[matched].contains(static_cast<unsigned char>(first[static_cast<std::ptrdiff_t>(matched)])))
+            {
+                ++matched;
+            }
+            if (matched == pattern.size())
+            {
+                return first;
+            }
+        }
+        return last;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(byte_class)
+    BOOST_AUTO_TEST_CASE(range_contains_its_bounds_and_everything_between)
+    {
+        const auto digits = burst::algorithm::byte_class::range('0', '9');
+
+        BOOST_CHECK_EQUAL(digits.count(), 10);
+        BOOST_CHECK(digits.contains('0'));
+        BOOST_CHECK(digits.contains('5'));
+        BOOST_CHECK(digits.contains('9'));
+        BOOST_CHECK(not digits.contains('a'));
+    }
+
+    BOOST_AUTO_TEST_CASE(complement_of_a_class_contains_all_other_bytes)
+    {
+        const auto not_space = ~burst::algorithm::byte_class(' ');
+
+        BOOST_CHECK_EQUAL(not_space.count(), 255);
+        BOOST_CHECK(not not_space.contains(' '));
+        BOOST_CHECK(not_space.contains(0));
+        BOOST_CHECK(not_space.contains(255));
+    }
+
+    BOOST_AUTO_TEST_CASE(pattern_syntax_is_parsed_into_one_class_per_element)
+    {
+        using burst::algorithm::byte_class;
+
+        const auto pattern = burst::algorithm::make_byte_class_pattern("a.[0-9x][^b]\\.[]-]");
+
+        const std::vector<byte_class> expected
+        {
+            byte_class('a'),
+            byte_class::any(),
+            byte_class::range('0', '9') | byte_class('x'),
+            ~byte_class('b'),
+            byte_class('.'),
+            byte_class::one_of("]-")
+        };
+        BOOST_CHECK(pattern == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(unsupported_or_broken_syntax_throws)
+    {
+        using burst::algorithm::make_byte_class_pattern;
+
+        BOOST_CHECK_THROW(make_byte_class_pattern("ab*"), std::invalid_argument);
+        BOOST_CHECK_THROW(make_byte_class_pattern("a?"), std::invalid_argument);
+        BOOST_CHECK_THROW(make_byte_class_pattern("[abc"), std::invalid_argument);
+        BOOST_CHECK_THROW(make_byte_class_pattern("[z-a]"), std::invalid_argument);
+        BOOST_CHECK_THROW(make_byte_class_pattern("abc\\"), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(bitap_finds_class_pattern)
+    {
+        const std::string text("2017-03-14 INFO 200 ok, 2017-03-14 ERROR 503 upstream");
+        const burst::algorithm::bitap<char, std::uint32_t> search(burst::algorithm::make_byte_class_pattern("[A-Z] [45][0-9][0-9]"));
+
+        BOOST_CHECK(search(text.begin(), text.end()) == text.begin() + 39);
+    }
+
+    BOOST_AUTO_TEST_CASE(bitap_agrees_with_naive_search)
+    {
+        std::default_random_engine engine;
+        std::uniform_int_distribution<int> letter('0', 'f');
+        std::string text(3000, '0');
+        for (auto & element: text)
+        {
+            element = static_cast<char>(letter(engine));
+        }
+
+        for (const std::string expression: {"[0-3].[a-c]", "[^0-9][0-9]", "..a", "[b-d][b-d][b-d]", "[^a-c]f"})
+        {
+            const auto pattern = burst::algorithm::make_byte_class_pattern(expression);
+            const burst::algorithm::bitap<char, std::uint64_t> search(pattern);
+
+            auto position = text.cbegin();
+            while (true)
+            {
+                const auto expected = naive_search(position, text.cend(), pattern);
+                const auto found = search(position, text.cend());
+                BOOST_REQUIRE(found == expected);
+                if (found == text.cend())
+                {
+                    break;
+                }
+                position = found + 1;
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(approximate_bitap_accepts_class_patterns)
+    {
+        const std::string text("id=12x4;");
+        const burst::algorithm::approximate_bitap<char, std::uint32_t> search(burst::algorithm::make_byte_class_pattern("=[0-9][0-9][0-9][0-9];"), 1);
+
+        const auto match = search(text.begin(), text.end());
+        BOOST_CHECK(match.range.end() == text.end());
+        BOOST_CHECK_EQUAL(match.errors, 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(make_bitap_deduces_byte_text_from_class_pattern)
+    {
+        const std::string text("GET /a 200, GET /b 404");
+        const auto search = burst::algorithm::make_bitap<std::uint64_t>(burst::algorithm::make_byte_class_pattern("[45][0-9][0-9]"));
+
+        BOOST_CHECK(search(text.begin(), text.end()) == text.begin() + 19);
+    }
+
+    BOOST_AUTO_TEST_CASE(make_approximate_bitap_deduces_byte_text_from_class_pattern)
+    {
+        const std::string text("id=12x4;");
+        const auto search = burst::algorithm::make_approximate_bitap<std::uint32_t>(burst::algorithm::make_byte_class_pattern("=[0-9][0-9][0-9][0-9];"), 1);
+
+        BOOST_CHECK_EQUAL(search(text.begin(), text.end()).errors, 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(multi_bitap_accepts_class_patterns)
+    {
+        const std::string text("a1 b22 a7b");
+        const std::vector<std::vector<burst::algorithm::byte_class>> patterns
+        {
+            burst::algorithm::make_byte_class_pattern("a[0-9]"),
+            burst::algorithm::make_byte_class_pattern("[0-9]b"),
+            burst::algorithm::make_byte_class_pattern("b[0-9][0-9]")
+        };
+
+        const burst::algorithm::multi_bitap<char, std::uint64_t> search(patterns);
+        std::vector<std::pair<std::size_t, std::size_t>> matches;
+        search(text.begin(), text.end(),
+            [& matches] (std::size_t pattern, std::size_t position)
+            {
+                matches.emplace_back(pattern, position);
+            });
+
+        const std::vector<std::pair<std::size_t, std::size_t>> expected{{0, 0}, {2, 3}, {0, 7}, {1, 8}};
+        BOOST_CHECK(matches == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(make_multi_bitap_deduces_byte_text_from_class_patterns)
+    {
+        const std::string text("x=1;y=22;");
+        const std::vector<std::vector<burst::algorithm::byte_class>> patterns
+        {
+            burst::algorithm::make_byte_class_pattern("=[0-9];"),
+            burst::algorithm::make_byte_class_pattern("[0-9][0-9]")
+        };
+
+        const auto search = burst::algorithm::make_multi_bitap<std::uint32_t>(patterns);
+        std::vector<std::pair<std::size_t, std::size_t>> matches;
+        search(text.begin(), text.end(),
+            [& matches] (std::size_t pattern, std::size_t position)
+            {
+                matches.emplace_back(pattern, position);
+            });
+
+        const std::vector<std::pair<std::size_t, std::size_t>> expected{{0, 1}, {1, 6}};
+        BOOST_CHECK(matches == expected);
+    }
+BOOST_AUTO_TEST_SUITE_END()
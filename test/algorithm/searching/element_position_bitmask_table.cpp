@@ -1,4 +1,5 @@
 #include <burst/algorithm/searching/detail/element_position_bitmask_table.hpp>
+#include <burst/algorithm/searching/flat_bitmask_map.hpp>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/utility/binary.hpp>
@@ -6,12 +7,15 @@
 #include <array>
 #include <bitset>
 #include <climits>
+#include <cstdint>
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 using char_masks = burst::algorithm::detail::element_position_bitmask_table<std::array<std::bitset<32>, (1 << sizeof(char) * CHAR_BIT)>>;
 using integral_masks = burst::algorithm::detail::element_position_bitmask_table<std::map<int, std::bitset<64>>>;
+using flat_masks = burst::algorithm::detail::element_position_bitmask_table<burst::algorithm::flat_bitmask_map<std::uint32_t, std::uint64_t>>;
 
 BOOST_AUTO_TEST_SUITE(element_position_bitmask_table)
     BOOST_AUTO_TEST_CASE(mask_created_from_empty_pattern_is_empty)
@@ -57,4 +61,46 @@ BOOST_AUTO_TEST_SUITE(element_position_bitmask_table)
 
         BOOST_CHECK_EQUAL(disjunction, (0x01 << pattern.length()) - 1);
     }
+
+    BOOST_AUTO_TEST_CASE(flat_table_stores_masks_of_repeating_elements)
+    {
+        flat_masks pattern_masks{100000, 7, 100000, 42};
+
+        BOOST_CHECK_EQUAL(pattern_masks[100000], BOOST_BINARY(0101));
+        BOOST_CHECK_EQUAL(pattern_masks[7], BOOST_BINARY(0010));
+        BOOST_CHECK_EQUAL(pattern_masks[42], BOOST_BINARY(1000));
+        BOOST_CHECK_EQUAL(pattern_masks.length(), 4);
+        BOOST_CHECK_EQUAL(pattern_masks.size(), 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(flat_table_gives_zero_mask_for_nonexistent_elements)
+    {
+        std::vector<std::uint32_t> pattern;
+        for (std::uint32_t element = 0; element < 64; ++element)
+        {
+            pattern.push_back(element * 1000);
+        }
+        flat_masks pattern_masks(pattern);
+
+        for (std::uint32_t element = 0; element < 64000; ++element)
+        {
+            const auto expected = element % 1000 == 0 ? std::uint64_t{1} << (element / 1000) : 0;
+            BOOST_REQUIRE_EQUAL(pattern_masks[element], expected);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(flat_table_finds_small_pattern_in_one_probe)
+    {
+        flat_masks pattern_masks{1, 2, 3, 4, 5, 6, 7, 8};
+        BOOST_CHECK_EQUAL(pattern_masks.probe_limit(), 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(flat_table_of_empty_pattern_is_empty)
+    {
+        flat_masks pattern_masks(std::vector<std::uint32_t>{});
+
+        BOOST_CHECK_EQUAL(pattern_masks.length(), 0);
+        BOOST_CHECK_EQUAL(pattern_masks[0], 0);
+        BOOST_CHECK_EQUAL(pattern_masks[1], 0);
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,141 @@
+#include <burst/algorithm/searching/multi_bitap.hpp>
+#include <test/output.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <forward_list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using match_type = std::pair<std::size_t, std::size_t>;
+
+    template <typename Searcher, typename ForwardRange>
+    std::vector<match_type> find_all (const Searcher & search, const ForwardRange & text)
+    {
+        std::vector<match_type> matches;
+        search(text.begin(), text.end(),
+            [& matches] (std::size_t pattern, std::size_t position)
+            {
+                matches.emplace_back(pattern, position);
+            });
+        return matches;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(multi_bitap)
+    BOOST_AUTO_TEST_CASE(single_pattern_is_found_like_by_plain_bitap)
+    {
+        const std::vector<std::string> patterns{"abc"};
+        const std::string text("xabcabcx");
+
+        const auto search = burst::algorithm::make_multi_bitap<std::uint8_t>(patterns);
+
+        const auto matches = find_all(search, text);
+        const std::vector<match_type> expected{{0, 1}, {0, 4}};
+        BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(all_patterns_are_reported_by_end_then_by_number)
+    {
+        const std::vector<std::string> patterns{"she", "he", "hers", "his"};
+        const std::string text("ushers and his");
+
+        const auto search = burst::algorithm::make_multi_bitap<std::uint16_t>(patterns);
+
+        const auto matches = find_all(search, text);
+        const std::vector<match_type> expected{{0, 1}, {1, 2}, {2, 2}, {3, 11}};
+        BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(carry_from_one_pattern_does_not_leak_into_the_next)
+    {
+        const std::vector<std::string> patterns{"ab", "bc"};
+        const std::string text("abc");
+
+        const auto search = burst::algorithm::make_multi_bitap<std::uint8_t>(patterns);
+
+        const auto matches = find_all(search, text);
+        const std::vector<match_type> expected{{0, 0}, {1, 1}};
+        BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(patterns_may_fill_the_bitmask_up_to_its_highest_bit)
+    {
+        const std::vector<std::string> patterns{"x", std::string(62, 'a'), "y"};
+        const std::string text(std::string(62, 'a') + "yx");
+
+        const auto search = burst::algorithm::make_multi_bitap<std::uint64_t>(patterns);
+
+        const auto matches = find_all(search, text);
+        const std::vector<match_type> expected{{1, 0}, {2, 62}, {0, 63}};
+        BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(many_patterns_fit_into_a_wide_bitset)
+    {
+        std::default_random_engine engine;
+        std::uniform_int_distribution<int> letter('a', 'd');
+        std::uniform_int_distribution<std::size_t> length(1, 9);
+
+        std::vector<std::string> patterns;
+        std::size_t total_length = 0;
+        while (true)
+        {
+            std::string pattern(length(engine), 'a');
+            for (auto & element: pattern)
+            {
+                element = static_cast<char>(letter(engine));
+            }
+            if (total_length + pattern.size() > 512)
+            {
+                break;
+            }
+            total_length += pattern.size();
+            patterns.push_back(pattern);
+        }
+
+        std::string text(2000, 'a');
+        for (auto & element: text)
+        {
+            element = static_cast<char>(letter(engine));
+        }
+
+        std::vector<match_type> expected;
+        for (std::size_t end = 1; end <= text.size(); ++end)
+        {
+            for (std::size_t pattern = 0; pattern < patterns.size(); ++pattern)
+            {
+                const auto size = patterns[pattern].size();
+                if (size <= end && text.compare(end - size, size, patterns[pattern]) == 0)
+                {
+                    expected.emplace_back(pattern, end - size);
+                }
+            }
+        }
+
+        const auto search = burst::algorithm::make_multi_bitap<std::bitset<512>>(patterns);
+        BOOST_CHECK_EQUAL(search.size(), patterns.size());
+
+        const auto matches = find_all(search, text);
+        BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(works_with_forward_iterators_and_arbitrary_map)
+    {
+        const std::vector<std::vector<int>> patterns{{1, 2}, {2, 3, 4}};
+        const std::forward_list<int> text{2, 3, 4, 1, 2, 3, 4};
+
+        const auto search = burst::algorithm::make_multi_bitap<std::uint32_t>(patterns);
+
+        const auto matches = find_all(search, text);
+        const std::vector<match_type> expected{{1, 0}, {0, 3}, {1, 4}};
+        BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+    }
+BOOST_AUTO_TEST_SUITE_END()
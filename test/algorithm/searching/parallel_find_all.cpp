@@ -0,0 +1,117 @@
+#include <burst/algorithm/searching/bitap.hpp>
+#include <burst/algorithm/searching/parallel_find_all.hpp>
+
+#include <boost/range/adaptor/transformed.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<std::size_t> find_all (const std::string & pattern, const std::string & text)
+    {
+        std::vector<std::size_t> result;
+        auto match = std::search(text.begin(), text.end(), pattern.begin(), pattern.end());
+        while (match != text.end())
+        {
+            result.push_back(static_cast<std::size_t>(match - text.begin()));
+            match = std::search(match + 1, text.end(), pattern.begin(), pattern.end());
+        }
+        return result;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(parallel_find_all)
+    BOOST_AUTO_TEST_CASE(finds_all_matches_in_ascending_order)
+    {
+        const std::string text("abcabcabcabc");
+        const auto search = burst::algorithm::make_bitap<std::uint32_t>(std::string("bca"));
+
+        const auto matches = burst::algorithm::parallel_find_all(search, text, 3);
+
+        const std::vector<std::size_t> expected{1, 4, 7};
+        BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(overlapping_matches_at_part_boundaries_are_found_exactly_once)
+    {
+        const std::string text(100, 'a');
+        const std::string pattern(7, 'a');
+        const auto search = burst::algorithm::make_bitap<std::uint32_t>(pattern);
+
+        for (std::size_t threads = 1; threads <= 16; ++threads)
+        {
+            const auto matches = burst::algorithm::parallel_find_all(search, text, threads);
+            const auto expected = find_all(pattern, text);
+            BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(agrees_with_sequential_search_for_any_thread_count)
+    {
+        std::default_random_engine engine;
+        std::uniform_int_distribution<int> letter('a', 'b');
+
+        std::string text(5000, 'a');
+        std::generate(text.begin(), text.end(), [&] { return static_cast<char>(letter(engine)); });
+
+        for (auto pattern_size: {1ul, 2ul, 5ul, 13ul, 64ul})
+        {
+            const auto pattern = text.substr(2500, pattern_size);
+            const auto search = burst::algorithm::make_bitap<std::uint64_t>(pattern);
+            const auto expected = find_all(pattern, text);
+
+            for (auto threads: {1ul, 2ul, 3ul, 7ul, 8ul, 100ul})
+            {
+                const auto matches = burst::algorithm::parallel_find_all(search, text, threads);
+                BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(more_threads_than_text_positions_is_fine)
+    {
+        const std::string text("abcd");
+        const auto search = burst::algorithm::make_bitap<std::uint32_t>(std::string("cd"));
+
+        const auto matches = burst::algorithm::parallel_find_all(search, text, 1000);
+
+        BOOST_REQUIRE_EQUAL(matches.size(), 1);
+        BOOST_CHECK_EQUAL(matches.front(), 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(text_shorter_than_pattern_has_no_matches)
+    {
+        const std::string text("ab");
+        const auto search = burst::algorithm::make_bitap<std::uint32_t>(std::string("abc"));
+
+        BOOST_CHECK(burst::algorithm::parallel_find_all(search, text, 4).empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(exception_thrown_in_a_worker_thread_reaches_the_caller)
+    {
+        std::string text(1000, 'a');
+        text[900] = '!';
+        const auto checked = [] (char c) -> char
+        {
+            if (c == '!')
+            {
+                throw std::runtime_error("Недопустимый символ.");
+            }
+            return c;
+        };
+        const auto search = burst::algorithm::make_bitap<std::uint32_t>(std::string("ab"));
+
+        BOOST_CHECK_THROW
+        (
+            burst::algorithm::parallel_find_all(search, text | boost::adaptors::transformed(checked), 4),
+            std::runtime_error
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
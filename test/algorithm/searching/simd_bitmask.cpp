@@ -0,0 +1,169 @@
+#include <burst/algorithm/searching/approximate_bitap.hpp>
+#include <burst/algorithm/searching/bitap.hpp>
+#include <burst/algorithm/searching/multi_bitap.hpp>
+#include <burst/algorithm/searching/simd_bitmask.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    std::string random_string (std::default_random_engine & engine, std::size_t size)
+    {
+        std::uniform_int_distribution<int> letter('a', 'b');
+        std::string result(size, 'a');
+        for (auto & element: result)
+        {
+            element = static_cast<char>(letter(engine));
+        }
+        return result;
+    }
+
+    template <std::size_t Bits>
+    std::vector<std::size_t> set_bits (const burst::algorithm::simd_bitmask<Bits> & bitmask)
+    {
+        std::vector<std::size_t> bits;
+        burst::algorithm::detail::for_each_set_bit<burst::algorithm::simd_bitmask<Bits>>{}(bitmask,
+            [& bits] (std::size_t bit)
+            {
+                bits.push_back(bit);
+            });
+        return bits;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(simd_bitmask)
+    BOOST_AUTO_TEST_CASE(main_bit_operation_carries_bits_across_words_and_registers)
+    {
+        using bitmask_type = burst::algorithm::simd_bitmask<512>;
+        const burst::algorithm::detail::bit_shift<bitmask_type> bit_shift{};
+
+        for (auto position: {0ul, 63ul, 64ul, 127ul, 128ul, 191ul, 255ul, 256ul, 383ul, 510ul})
+        {
+            const auto bitmask = bit_shift(bitmask_type{1} << position);
+
+            const std::vector<std::size_t> expected{0, position + 1};
+            const auto actual = set_bits(bitmask);
+            BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(highest_bit_is_shifted_out)
+    {
+        using bitmask_type = burst::algorithm::simd_bitmask<256>;
+        const burst::algorithm::detail::bit_shift<bitmask_type> bit_shift{};
+
+        BOOST_CHECK(bit_shift(bitmask_type{1} << 255) == bitmask_type{1});
+    }
+
+    BOOST_AUTO_TEST_CASE(shift_by_many_bits_matches_std_bitset)
+    {
+        using bitmask_type = burst::algorithm::simd_bitmask<256>;
+        const auto pattern = 0x8000000000000001ull;
+
+        for (auto shift: {0ul, 1ul, 63ul, 64ul, 65ul, 128ul, 200ul, 255ul, 256ul})
+        {
+            const auto expected = std::bitset<256>(pattern) << shift;
+            const auto bitmask = bitmask_type{pattern} << shift;
+
+            for (std::size_t bit = 0; bit < 256; ++bit)
+            {
+                BOOST_REQUIRE_EQUAL(bitmask.test(bit), expected.test(bit));
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(bitmask_with_a_single_bit_in_any_register_is_not_zero)
+    {
+        using bitmask_type = burst::algorithm::simd_bitmask<512>;
+
+        BOOST_CHECK(not bitmask_type{}.any());
+        BOOST_CHECK(bitmask_type{} == bitmask_type{0});
+        for (auto position: {0ul, 200ul, 511ul})
+        {
+            const auto bitmask = bitmask_type{1} << position;
+            BOOST_CHECK(bitmask.any());
+            BOOST_CHECK(bitmask != bitmask_type{0});
+            BOOST_CHECK((bitmask & (bitmask_type{1} << (position ^ 1))) == bitmask_type{0});
+            BOOST_CHECK((bitmask | bitmask_type{1}).test(0));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(bitap_finds_patterns_longer_than_a_register)
+    {
+        std::default_random_engine engine;
+
+        for (auto pattern_size: {1ul, 64ul, 65ul, 128ul, 129ul, 200ul, 256ul})
+        {
+            const auto pattern = random_string(engine, pattern_size);
+            auto text = random_string(engine, 3000);
+            text.replace(1000, pattern.size(), pattern);
+            text.replace(2500, pattern.size(), pattern);
+
+            const burst::algorithm::bitap<char, burst::algorithm::simd_bitmask<256>> search(pattern);
+
+            auto expected = text.begin();
+            auto found = text.begin();
+            while (true)
+            {
+                expected = std::search(expected, text.end(), pattern.begin(), pattern.end());
+                found = search(found, text.end());
+                BOOST_REQUIRE(found == expected);
+                if (found == text.end())
+                {
+                    break;
+                }
+                ++expected;
+                ++found;
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(approximate_bitap_finds_same_matches_as_with_std_bitset)
+    {
+        std::default_random_engine engine;
+        const auto pattern = random_string(engine, 150);
+        auto text = random_string(engine, 2000);
+        auto distorted = pattern;
+        distorted[10] = distorted[10] == 'a' ? 'b' : 'a';
+        distorted.erase(100, 1);
+        text.replace(700, distorted.size(), distorted);
+
+        const auto simd = burst::algorithm::make_approximate_bitap<burst::algorithm::simd_bitmask<256>>(pattern, 3);
+        const auto bitset = burst::algorithm::make_approximate_bitap<std::bitset<256>>(pattern, 3);
+
+        const auto simd_match = simd(text.begin(), text.end());
+        const auto bitset_match = bitset(text.begin(), text.end());
+
+        BOOST_CHECK(simd_match.range.begin() == bitset_match.range.begin());
+        BOOST_CHECK(simd_match.range.end() == bitset_match.range.end());
+        BOOST_CHECK_EQUAL(simd_match.errors, bitset_match.errors);
+        BOOST_CHECK(not simd_match.range.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(multi_bitap_reports_patterns_ending_in_every_register)
+    {
+        const std::vector<std::string> patterns{std::string(100, 'a'), std::string(100, 'a') + "b", "ab", "b"};
+        const std::string text(std::string(100, 'a') + "b");
+
+        const auto search = burst::algorithm::make_multi_bitap<burst::algorithm::simd_bitmask<256>>(patterns);
+
+        std::vector<std::pair<std::size_t, std::size_t>> matches;
+        search(text.begin(), text.end(),
+            [& matches] (std::size_t pattern, std::size_t position)
+            {
+                matches.emplace_back(pattern, position);
+            });
+
+        const std::vector<std::pair<std::size_t, std::size_t>> expected{{0, 0}, {1, 0}, {2, 99}, {3, 100}};
+        BOOST_CHECK(matches == expected);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,107 @@
+#include <burst/algorithm/searching/streaming_bitap.hpp>
+#include <burst/range/binary_istream_range.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<std::size_t> find_all (const std::string & pattern, const std::string & text)
+    {
+        std::vector<std::size_t> result;
+        auto match = std::search(text.begin(), text.end(), pattern.begin(), pattern.end());
+        while (match != text.end())
+        {
+            result.push_back(static_cast<std::size_t>(match - text.begin()));
+            match = std::search(match + 1, text.end(), pattern.begin(), pattern.end());
+        }
+        return result;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(streaming_bitap)
+    BOOST_AUTO_TEST_CASE(match_spanning_block_boundary_is_reported_with_absolute_offset)
+    {
+        auto search = burst::algorithm::make_streaming_bitap<std::uint32_t>(std::string("abcd"));
+
+        std::vector<std::size_t> matches;
+        const auto remember = [& matches] (std::size_t offset) { matches.push_back(offset); };
+        search.feed(std::string("xxab"), remember);
+        search.feed(std::string("cdxa"), remember);
+        search.feed(std::string("b"), remember);
+        search.feed(std::string("cd"), remember);
+
+        const std::vector<std::size_t> expected{2, 7};
+        BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+        BOOST_CHECK_EQUAL(search.offset(), 11);
+    }
+
+    BOOST_AUTO_TEST_CASE(any_block_size_gives_the_same_matches_as_whole_text_search)
+    {
+        std::default_random_engine engine;
+        std::uniform_int_distribution<int> letter('a', 'b');
+
+        std::string text(2000, 'a');
+        std::generate(text.begin(), text.end(), [&] { return static_cast<char>(letter(engine)); });
+
+        for (auto pattern_size: {1ul, 3ul, 10ul, 64ul})
+        {
+            const auto pattern = text.substr(1000, pattern_size);
+            const auto expected = find_all(pattern, text);
+
+            for (auto block_size: {1ul, 2ul, 7ul, 63ul, 64ul, 65ul, 5000ul})
+            {
+                auto search = burst::algorithm::make_streaming_bitap<std::uint64_t>(pattern);
+
+                std::vector<std::size_t> matches;
+                for (std::size_t block = 0; block < text.size(); block += block_size)
+                {
+                    const auto block_end = std::min(block + block_size, text.size());
+                    search.feed(text.begin() + static_cast<std::ptrdiff_t>(block), text.begin() + static_cast<std::ptrdiff_t>(block_end),
+                        [& matches] (std::size_t offset) { matches.push_back(offset); });
+                }
+
+                BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(reads_elements_directly_from_binary_input_stream)
+    {
+        const std::vector<std::uint32_t> text{5, 1, 2, 3, 1, 2, 1, 2, 3, 7};
+        std::stringstream stream;
+        stream.write(reinterpret_cast<const char *>(text.data()), static_cast<std::streamsize>(text.size() * sizeof(std::uint32_t)));
+
+        const std::vector<std::uint32_t> pattern{1, 2, 3};
+        auto search = burst::algorithm::make_streaming_bitap<std::uint8_t>(pattern);
+
+        std::vector<std::size_t> matches;
+        search.feed(burst::make_binary_istream_range<std::uint32_t>(stream),
+            [& matches] (std::size_t offset) { matches.push_back(offset); });
+
+        const std::vector<std::size_t> expected{1, 6};
+        BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(reset_starts_a_new_text)
+    {
+        auto search = burst::algorithm::make_streaming_bitap<std::uint32_t>(std::string("ab"));
+
+        std::vector<std::size_t> matches;
+        const auto remember = [& matches] (std::size_t offset) { matches.push_back(offset); };
+        search.feed(std::string("xxa"), remember);
+        search.reset();
+        search.feed(std::string("bab"), remember);
+
+        BOOST_REQUIRE_EQUAL(matches.size(), 1);
+        BOOST_CHECK_EQUAL(matches.front(), 1);
+        BOOST_CHECK_EQUAL(search.offset(), 3);
+    }
+BOOST_AUTO_TEST_SUITE_END()
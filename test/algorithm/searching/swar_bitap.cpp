@@ -0,0 +1,146 @@
+#include <burst/algorithm/searching/swar_bitap.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::string random_string (std::default_random_engine & engine, std::size_t size, char last_letter)
+    {
+        std::uniform_int_distribution<int> letter('a', last_letter);
+        std::string result(size, 'a');
+        for (auto & element: result)
+        {
+            element = static_cast<char>(letter(engine));
+        }
+        return result;
+    }
+
+    void check_all_matches (const std::string & pattern, const std::string & text)
+    {
+        const auto search = burst::algorithm::make_swar_bitap(pattern);
+
+        auto expected = text.begin();
+        auto found = text.begin();
+        while (true)
+        {
+            expected = std::search(expected, text.end(), pattern.begin(), pattern.end());
+            found = search(found, text.end());
+            BOOST_REQUIRE(found == expected);
+            if (found == text.end())
+            {
+                break;
+            }
+            ++expected;
+            ++found;
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(swar_bitap)
+    BOOST_AUTO_TEST_CASE(finds_first_match)
+    {
+        const std::string text("hello, world");
+        const auto search = burst::algorithm::make_swar_bitap(std::string("wor"));
+
+        BOOST_CHECK(search(text.begin(), text.end()) == text.begin() + 7);
+    }
+
+    BOOST_AUTO_TEST_CASE(returns_end_when_there_is_no_match)
+    {
+        const std::string text(5000, 'a');
+        const auto search = burst::algorithm::make_swar_bitap(std::string("ab"));
+
+        BOOST_CHECK(search(text.begin(), text.end()) == text.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(agrees_with_std_search_for_every_lane_width)
+    {
+        std::default_random_engine engine;
+        for (auto pattern_size: {1ul, 2ul, 7ul, 8ul, 9ul, 16ul, 17ul, 32ul})
+        {
+            for (auto text_size: {0ul, 10ul, 1000ul, 3000ul, 10000ul})
+            {
+                const auto text = random_string(engine, text_size, 'b');
+                const auto pattern = random_string(engine, pattern_size, 'b');
+                check_all_matches(pattern, text);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(matches_crossing_lane_and_block_boundaries_are_found)
+    {
+        const std::string pattern("abcdefgh");
+        std::string text(8192, 'x');
+        for (std::size_t position: {0ul, 250ul, 252ul, 256ul, 1020ul, 2044ul, 2045ul, 4090ul, 8184ul})
+        {
+            text.replace(position, pattern.size(), pattern);
+        }
+        check_all_matches(pattern, text);
+    }
+
+    BOOST_AUTO_TEST_CASE(earlier_lane_wins_over_earlier_step_in_later_lane)
+    {
+        // Во второй дорожке вхождение находится на первых шагах блока, а в первой — только в
+        // конце её куска. Ответом должно быть вхождение первой дорожки.
+        const std::string pattern("abc");
+        std::string text(4096, 'x');
+        text.replace(254, pattern.size(), pattern);
+        text.replace(257, pattern.size(), pattern);
+
+        const auto search = burst::algorithm::make_swar_bitap(pattern);
+        BOOST_CHECK(search(text.begin(), text.end()) == text.begin() + 254);
+    }
+
+    BOOST_AUTO_TEST_CASE(text_which_is_not_contiguous_is_searched_by_lanes)
+    {
+        std::default_random_engine engine;
+        for (auto pattern_size: {3ul, 12ul, 30ul})
+        {
+            const auto pattern = random_string(engine, pattern_size, 'b');
+            auto text = random_string(engine, 5000, 'b');
+            text.replace(3000, pattern.size(), pattern);
+            const std::deque<char> deque(text.begin(), text.end());
+
+            const auto search = burst::algorithm::make_swar_bitap(pattern);
+            const auto expected = std::search(deque.begin(), deque.end(), pattern.begin(), pattern.end());
+            BOOST_CHECK(search(deque.begin(), deque.end()) == expected);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(candidates_with_matching_ends_but_different_middle_are_rejected)
+    {
+        const std::string pattern("abcda");
+        std::string text(100, 'a');
+        text.replace(90, pattern.size(), pattern);
+
+        const auto search = burst::algorithm::make_swar_bitap(pattern);
+        BOOST_CHECK(search(text.begin(), text.end()) == text.begin() + 90);
+    }
+
+    BOOST_AUTO_TEST_CASE(match_is_found_in_text_full_of_false_candidates)
+    {
+        const std::string pattern("abcda");
+        std::string text(100000, 'a');
+        text.replace(99990, pattern.size(), pattern);
+
+        const auto search = burst::algorithm::make_swar_bitap(pattern);
+        BOOST_CHECK(search(text.begin(), text.end()) == text.begin() + 99990);
+    }
+
+    BOOST_AUTO_TEST_CASE(works_with_unsigned_bytes)
+    {
+        const std::vector<std::uint8_t> text{0, 255, 128, 0, 255, 128, 7};
+        const std::vector<std::uint8_t> pattern{255, 128, 7};
+
+        const auto search = burst::algorithm::make_swar_bitap(pattern);
+        BOOST_CHECK(search(text.begin(), text.end()) == text.begin() + 4);
+    }
+BOOST_AUTO_TEST_SUITE_END()
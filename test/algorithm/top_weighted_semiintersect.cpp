@@ -0,0 +1,95 @@
+#include <burst/algorithm/top_weighted_semiintersect.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(top_weighted_semiintersect)
+    BOOST_AUTO_TEST_CASE(returns_heaviest_elements_in_descending_weight_order)
+    {
+        auto  first = {1, 2, 3, 4, 5, 6};
+        auto second = {   2,    4,    6};
+        auto  third = {         4, 5, 6};
+
+        auto ranges = burst::make_range_vector(first, second, third);
+        auto weights = burst::make_vector({1, 2, 4});
+
+        auto top =
+            burst::top_weighted_semiintersect
+            (
+                boost::make_iterator_range(ranges),
+                boost::make_iterator_range(weights),
+                2
+            );
+
+        BOOST_REQUIRE_EQUAL(top.size(), 2);
+        BOOST_CHECK_EQUAL(top[0].second, 7);
+        BOOST_CHECK_EQUAL(top[1].second, 7);
+        BOOST_CHECK_EQUAL(top[0].first + top[1].first, 4 + 6);
+    }
+
+    BOOST_AUTO_TEST_CASE(returns_all_elements_if_there_are_not_enough_of_them)
+    {
+        auto  first = {1, 3};
+        auto second = {2, 3};
+
+        auto ranges = burst::make_range_vector(first, second);
+        auto weights = burst::make_vector({1, 2});
+
+        auto top =
+            burst::top_weighted_semiintersect
+            (
+                boost::make_iterator_range(ranges),
+                boost::make_iterator_range(weights),
+                10
+            );
+
+        auto expected =
+            burst::make_vector({std::make_pair(3, 3), std::make_pair(2, 2), std::make_pair(1, 1)});
+        BOOST_CHECK(top == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(top_of_zero_elements_is_empty)
+    {
+        auto first = {1, 2, 3};
+
+        auto ranges = burst::make_range_vector(first);
+        auto weights = burst::make_vector({1});
+
+        auto top =
+            burst::top_weighted_semiintersect
+            (
+                boost::make_iterator_range(ranges),
+                boost::make_iterator_range(weights),
+                0
+            );
+
+        BOOST_CHECK(top.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(supports_custom_ordering)
+    {
+        auto  first = {3, 2, 1};
+        auto second = {3,    1};
+
+        auto ranges = burst::make_range_vector(first, second);
+        auto weights = burst::make_vector({2, 1});
+
+        auto top =
+            burst::top_weighted_semiintersect
+            (
+                boost::make_iterator_range(ranges),
+                boost::make_iterator_range(weights),
+                1,
+                std::greater<>{}
+            );
+
+        BOOST_CHECK_EQUAL(top.size(), 1);
+        BOOST_CHECK_EQUAL(top.front().second, 3);
+    }
+BOOST_AUTO_TEST_SUITE_END()
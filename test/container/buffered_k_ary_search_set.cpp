@@ -0,0 +1,117 @@
+#include <burst/container/buffered_k_ary_search_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(buffered_k_ary_search_set)
+    BOOST_AUTO_TEST_CASE(buffered_k_ary_search_set_initialized_with_default_constructor_is_empty)
+    {
+        burst::buffered_k_ary_search_set<int> set;
+
+        BOOST_CHECK(set.empty());
+        BOOST_CHECK_EQUAL(set.size(), 0);
+        BOOST_CHECK(set.find(17) == nullptr);
+    }
+
+    BOOST_AUTO_TEST_CASE(inserted_element_is_found)
+    {
+        burst::buffered_k_ary_search_set<int> set({1, 3, 5}, 3);
+
+        BOOST_CHECK(set.insert(4));
+        BOOST_CHECK(not set.insert(4));
+        BOOST_CHECK(not set.insert(3));
+
+        BOOST_CHECK_EQUAL(set.size(), 4);
+        BOOST_REQUIRE(set.find(4) != nullptr);
+        BOOST_CHECK_EQUAL(*set.find(4), 4);
+    }
+
+    BOOST_AUTO_TEST_CASE(erased_element_is_not_found)
+    {
+        burst::buffered_k_ary_search_set<int> set({1, 3, 5}, 3);
+
+        BOOST_CHECK_EQUAL(set.erase(3), 1);
+        BOOST_CHECK_EQUAL(set.erase(3), 0);
+        BOOST_CHECK_EQUAL(set.erase(4), 0);
+
+        BOOST_CHECK_EQUAL(set.size(), 2);
+        BOOST_CHECK(not set.contains(3));
+        BOOST_CHECK(set.contains(1));
+    }
+
+    BOOST_AUTO_TEST_CASE(erased_element_of_core_can_be_inserted_back)
+    {
+        burst::buffered_k_ary_search_set<int> set({1, 3, 5}, 3);
+
+        set.erase(3);
+        BOOST_CHECK(set.insert(3));
+
+        BOOST_CHECK(set.contains(3));
+        BOOST_CHECK_EQUAL(set.size(), 3);
+        BOOST_CHECK_EQUAL(set.delta_size(), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(rebuild_merges_changes_into_core)
+    {
+        burst::buffered_k_ary_search_set<int> set({1, 3, 5}, 3);
+        set.insert(2);
+        set.insert(6);
+        set.erase(1);
+
+        set.rebuild();
+
+        BOOST_CHECK_EQUAL(set.delta_size(), 0);
+        const auto expected = {2, 3, 5, 6};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            set.core().ordered_begin(), set.core().ordered_end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(delta_never_exceeds_its_limit)
+    {
+        burst::buffered_k_ary_search_set<int> set;
+        for (int i = 0; i < 1000; ++i)
+        {
+            set.insert(i);
+            BOOST_CHECK_LE(set.delta_size(), set.delta_limit());
+        }
+        BOOST_CHECK_GE(set.core().size(), 1000 - set.delta_limit());
+    }
+
+    BOOST_AUTO_TEST_CASE(behaves_like_std_set_under_random_updates)
+    {
+        std::vector<int> initial(500);
+        std::generate(initial.begin(), initial.end(), [n = 0] () mutable { return n += 4; });
+
+        burst::buffered_k_ary_search_set<int> set(burst::container::unique_ordered_tag, initial.begin(), initial.end(), 5);
+        std::set<int> expected(initial.begin(), initial.end());
+
+        std::default_random_engine engine;
+        std::uniform_int_distribution<int> uniform(0, 2100);
+        for (std::size_t step = 0; step < 5000; ++step)
+        {
+            const auto value = uniform(engine);
+            if (step % 3 == 0)
+            {
+                BOOST_CHECK_EQUAL(set.erase(value), expected.erase(value));
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL(set.insert(value), expected.insert(value).second);
+            }
+            BOOST_REQUIRE_EQUAL(set.size(), expected.size());
+        }
+
+        for (int value = -1; value < 2102; ++value)
+        {
+            BOOST_CHECK_EQUAL(set.contains(value), expected.count(value) == 1);
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -4,6 +4,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -630,4 +631,88 @@ BOOST_AUTO_TEST_SUITE(dynamic_tuple)
 
         swap(t, u);
     }
+    BOOST_AUTO_TEST_CASE(trivially_copyable_elements_survive_reallocation)
+    {
+        struct point
+        {
+            double x;
+            std::int16_t y;
+        };
+
+        burst::dynamic_tuple t;
+        for (int i = 0; i < 100; ++i)
+        {
+            t.push_back(point{i * 0.5, static_cast<std::int16_t>(i)});
+            t.push_back(static_cast<char>('a' + i % 26));
+        }
+        t.shrink_to_fit();
+
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            BOOST_CHECK_EQUAL(t.get<point>(2 * i).x, static_cast<double>(i) * 0.5);
+            BOOST_CHECK_EQUAL(t.get<point>(2 * i).y, i);
+            BOOST_CHECK_EQUAL(t.get<char>(2 * i + 1), 'a' + i % 26);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(copy_of_trivially_copyable_tuple_is_independent_of_original)
+    {
+        auto t = burst::dynamic_tuple(1, 3.14, 'q');
+        const auto u = t;
+        t.get<int>(0) = 2;
+
+        BOOST_CHECK_EQUAL(u.get<int>(0), 1);
+        BOOST_CHECK_EQUAL(u.get<double>(1), 3.14);
+        BOOST_CHECK_EQUAL(u.get<char>(2), 'q');
+    }
+
+    BOOST_AUTO_TEST_CASE(moved_from_trivially_copyable_tuple_is_empty_and_can_be_copied)
+    {
+        auto t = burst::dynamic_tuple(1, 3.14, 'q');
+        const auto u = std::move(t);
+
+        const auto v = t;
+        BOOST_CHECK(v.empty());
+        BOOST_CHECK_EQUAL(v.volume(), 0);
+        BOOST_CHECK_EQUAL(u.get<char>(2), 'q');
+    }
+
+    BOOST_AUTO_TEST_CASE(moved_from_trivially_copyable_tuple_can_reserve_and_grow)
+    {
+        auto t = burst::dynamic_tuple(1, 3.14, 'q');
+        const auto u = std::move(t);
+
+        t.reserve(100);
+        t.push_back(7);
+        BOOST_CHECK_GE(t.capacity(), 100);
+        BOOST_CHECK_EQUAL(t.size(), 1);
+        BOOST_CHECK_EQUAL(t.get<int>(0), 7);
+    }
+
+    BOOST_AUTO_TEST_CASE(tuple_with_non_trivial_element_copies_it_with_its_copy_constructor)
+    {
+        {
+            auto t = burst::dynamic_tuple(1, dummy{}, 2.0);
+            BOOST_REQUIRE_EQUAL(dummy::instances_count, 1);
+
+            const auto u = t;
+            BOOST_CHECK_EQUAL(dummy::instances_count, 2);
+
+            t.reserve(t.capacity() * 4);
+            BOOST_CHECK_EQUAL(dummy::instances_count, 2);
+        }
+        BOOST_CHECK_EQUAL(dummy::instances_count, 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(popping_last_non_trivial_element_leaves_a_correct_trivial_tuple)
+    {
+        auto t = burst::dynamic_tuple(7, std::string("qwe"));
+        t.pop_back();
+        t.push_back(3.5);
+        t.reserve(t.capacity() * 4);
+
+        const auto u = t;
+        BOOST_CHECK_EQUAL(u.get<int>(0), 7);
+        BOOST_CHECK_EQUAL(u.get<double>(1), 3.5);
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,61 @@
+#include <burst/container/dynamic_tuple_schema.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(dynamic_tuple_schema)
+    BOOST_AUTO_TEST_CASE(offsets_are_aligned_and_follow_each_other)
+    {
+        const auto schema = burst::make_dynamic_tuple_schema<char, std::int32_t, char, double>();
+
+        BOOST_CHECK_EQUAL(schema->size(), 4);
+        BOOST_CHECK_EQUAL(schema->offset(0), 0);
+        BOOST_CHECK_EQUAL(schema->offset(1), alignof(std::int32_t));
+        BOOST_CHECK_EQUAL(schema->offset(2), alignof(std::int32_t) + sizeof(std::int32_t));
+        BOOST_CHECK_EQUAL(schema->offset(3) % alignof(double), 0);
+        BOOST_CHECK_EQUAL(schema->volume(), schema->offset(3) + sizeof(double));
+        BOOST_CHECK_EQUAL(schema->alignment(), alignof(double));
+    }
+
+    BOOST_AUTO_TEST_CASE(schema_of_trivially_copyable_types_is_trivially_copyable)
+    {
+        const auto trivial = burst::make_dynamic_tuple_schema<int, double, char>();
+        const auto non_trivial = burst::make_dynamic_tuple_schema<int, std::string>();
+
+        BOOST_CHECK(trivial->is_trivially_copyable());
+        BOOST_CHECK(not non_trivial->is_trivially_copyable());
+    }
+
+    BOOST_AUTO_TEST_CASE(schema_can_be_built_at_runtime)
+    {
+        burst::dynamic_tuple_schema schema;
+        for (auto column: {'i', 's', 'd'})
+        {
+            switch (column)
+            {
+                case 'i': schema.push_back<int>(); break;
+                case 's': schema.push_back<std::string>(); break;
+                case 'd': schema.push_back<double>(); break;
+            }
+        }
+
+        BOOST_CHECK_EQUAL(schema.size(), 3);
+        BOOST_CHECK(schema.type(0) == typeid(int));
+        BOOST_CHECK(schema.type(1) == typeid(std::string));
+        BOOST_CHECK(schema.type(2) == typeid(double));
+        BOOST_CHECK(schema.holds<std::string>(1));
+        BOOST_CHECK(not schema.holds<int>(1));
+    }
+
+    BOOST_AUTO_TEST_CASE(empty_schema_has_zero_volume)
+    {
+        const auto schema = burst::make_dynamic_tuple_schema<>();
+
+        BOOST_CHECK(schema->empty());
+        BOOST_CHECK_EQUAL(schema->volume(), 0);
+        BOOST_CHECK(schema->is_trivially_copyable());
+    }
+BOOST_AUTO_TEST_SUITE_END()
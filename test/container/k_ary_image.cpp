@@ -0,0 +1,154 @@
+#include <burst/container/k_ary_image.hpp>
+#include <burst/container/k_ary_search_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct temporary_file
+    {
+        temporary_file ():
+            path("burst_k_ary_image_test.bin")
+        {
+        }
+
+        ~temporary_file ()
+        {
+            std::remove(path.c_str());
+        }
+
+        template <typename Set>
+        void write (const Set & set) const
+        {
+            std::ofstream stream(path, std::ios::binary);
+            burst::container::write_image(set, stream);
+        }
+
+        std::string path;
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(k_ary_image)
+    BOOST_AUTO_TEST_CASE(mapped_set_has_the_same_layout_as_the_written_one)
+    {
+        std::vector<std::int64_t> numbers(1000);
+        std::iota(numbers.begin(), numbers.end(), -500);
+        const burst::k_ary_search_set<std::int64_t> original(numbers.begin(), numbers.end(), 9);
+
+        temporary_file file;
+        file.write(original);
+
+        using set_type = burst::k_ary_search_set<std::int64_t, std::less<std::int64_t>, burst::container::mapped_nodes<>>;
+        const auto mapped = burst::container::load_image<set_type>(burst::container::k_ary_image(file.path));
+
+        BOOST_CHECK_EQUAL(mapped.size(), original.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(mapped.begin(), mapped.end(), original.begin(), original.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(mapped_set_finds_every_element_and_nothing_else)
+    {
+        std::vector<std::uint32_t> numbers(777);
+        std::generate(numbers.begin(), numbers.end(), [n = 0u] () mutable { return n += 2; });
+
+        temporary_file file;
+        file.write(burst::k_ary_search_set<std::uint32_t, std::less<std::uint32_t>, burst::container::cache_aligned_nodes>(numbers.begin(), numbers.end(), 5));
+
+        using set_type = burst::k_ary_search_set<std::uint32_t, std::less<std::uint32_t>, burst::container::mapped_nodes<burst::container::cache_aligned_nodes>>;
+        const auto set = burst::container::load_image<set_type>(burst::container::k_ary_image(file.path));
+
+        for (std::uint32_t value = 0; value < 2 * 777 + 3; ++value)
+        {
+            const auto found = set.find(value);
+            if (value > 0 && value <= 2 * 777 && value % 2 == 0)
+            {
+                BOOST_REQUIRE(found != set.end());
+                BOOST_CHECK_EQUAL(*found, value);
+            }
+            else
+            {
+                BOOST_CHECK(found == set.end());
+            }
+        }
+        BOOST_CHECK(std::equal(set.ordered_begin(), set.ordered_end(), numbers.begin(), numbers.end()));
+    }
+
+    BOOST_AUTO_TEST_CASE(image_can_be_loaded_into_owning_storage)
+    {
+        temporary_file file;
+        file.write(burst::k_ary_search_set<int>({5, 3, 1, 4, 2}, 3));
+
+        const auto set = burst::container::load_image<burst::k_ary_search_set<int>>(burst::container::k_ary_image(file.path));
+
+        BOOST_CHECK_EQUAL(set.size(), 5);
+        BOOST_CHECK(set.find(4) != set.end());
+        BOOST_CHECK(set.find(6) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(mapping_outlives_the_image_object)
+    {
+        temporary_file file;
+        file.write(burst::k_ary_search_set<int>({1, 2, 3}, 3));
+
+        using set_type = burst::k_ary_search_set<int, std::less<int>, burst::container::mapped_nodes<>>;
+        const auto set =
+            [& file]
+            {
+                burst::container::k_ary_image image(file.path);
+                return burst::container::load_image<set_type>(image);
+            }();
+
+        BOOST_CHECK(set.find(2) != set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(image_of_empty_set_is_empty)
+    {
+        temporary_file file;
+        file.write(burst::k_ary_search_set<int>());
+
+        using set_type = burst::k_ary_search_set<int, std::less<int>, burst::container::mapped_nodes<>>;
+        const auto set = burst::container::load_image<set_type>(burst::container::k_ary_image(file.path));
+
+        BOOST_CHECK(set.empty());
+        BOOST_CHECK(set.find(1) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(image_of_other_value_type_is_rejected)
+    {
+        temporary_file file;
+        file.write(burst::k_ary_search_set<std::int32_t>({1, 2, 3}, 3));
+
+        using set_type = burst::k_ary_search_set<std::int64_t, std::less<std::int64_t>, burst::container::mapped_nodes<>>;
+        BOOST_CHECK_THROW(burst::container::load_image<set_type>(burst::container::k_ary_image(file.path)), std::runtime_error);
+    }
+
+    BOOST_AUTO_TEST_CASE(image_of_other_node_storage_is_rejected)
+    {
+        temporary_file file;
+        file.write(burst::k_ary_search_set<std::int32_t>({1, 2, 3, 4, 5}, 4));
+
+        using set_type = burst::k_ary_search_set<std::int32_t, std::less<std::int32_t>, burst::container::mapped_nodes<burst::container::cache_aligned_nodes>>;
+        BOOST_CHECK_THROW(burst::container::load_image<set_type>(burst::container::k_ary_image(file.path)), std::runtime_error);
+    }
+
+    BOOST_AUTO_TEST_CASE(file_which_is_not_an_image_is_rejected)
+    {
+        temporary_file file;
+        {
+            std::ofstream stream(file.path, std::ios::binary);
+            stream << std::string(100, 'x');
+        }
+
+        BOOST_CHECK_THROW(burst::container::k_ary_image(file.path), std::runtime_error);
+        BOOST_CHECK_THROW(burst::container::k_ary_image(file.path + ".absent"), std::runtime_error);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+#include <burst/container/k_ary_search_map.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(k_ary_search_map)
+    BOOST_AUTO_TEST_CASE(k_ary_search_map_initialized_with_default_constructor_is_empty)
+    {
+        burst::k_ary_search_map<int, std::string> map;
+
+        BOOST_CHECK(map.empty());
+        BOOST_CHECK_EQUAL(map.size(), 0);
+        BOOST_CHECK(map.find(17) == nullptr);
+    }
+
+    BOOST_AUTO_TEST_CASE(every_key_is_mapped_to_its_own_value)
+    {
+        std::vector<std::pair<int, int>> pairs;
+        for (int key = 0; key < 1000; key += 3)
+        {
+            pairs.emplace_back(key, key * key);
+        }
+
+        burst::k_ary_search_map<int, int> map(burst::container::unique_ordered_tag, pairs.begin(), pairs.end(), 5);
+        BOOST_REQUIRE_EQUAL(map.size(), pairs.size());
+
+        for (int key = -1; key < 1002; ++key)
+        {
+            const auto mapped = map.find(key);
+            if (key >= 0 && key % 3 == 0)
+            {
+                BOOST_REQUIRE(mapped != nullptr);
+                BOOST_CHECK_EQUAL(*mapped, key * key);
+            }
+            else
+            {
+                BOOST_CHECK(mapped == nullptr);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(unordered_input_is_sorted_and_first_value_of_repeated_key_is_kept)
+    {
+        burst::k_ary_search_map<int, std::string> map({{3, "c"}, {1, "a"}, {2, "b"}, {1, "z"}}, 3);
+
+        BOOST_CHECK_EQUAL(map.size(), 3);
+        BOOST_CHECK_EQUAL(map.at(1), "a");
+        BOOST_CHECK_EQUAL(map.at(2), "b");
+        BOOST_CHECK_EQUAL(map.at(3), "c");
+    }
+
+    BOOST_AUTO_TEST_CASE(at_throws_on_absent_key)
+    {
+        const burst::k_ary_search_map<int, int> map({{1, 10}, {2, 20}});
+
+        BOOST_CHECK_EQUAL(map.at(2), 20);
+        BOOST_CHECK_THROW(map.at(3), std::out_of_range);
+        BOOST_CHECK(map.contains(1));
+        BOOST_CHECK(not map.contains(0));
+    }
+
+    BOOST_AUTO_TEST_CASE(mapped_value_can_be_modified_through_lookup)
+    {
+        burst::k_ary_search_map<int, int> map({{1, 10}, {2, 20}, {3, 30}}, 3);
+
+        *map.find(2) = 200;
+        map.at(3) += 3;
+
+        BOOST_CHECK_EQUAL(map.at(1), 10);
+        BOOST_CHECK_EQUAL(map.at(2), 200);
+        BOOST_CHECK_EQUAL(map.at(3), 33);
+    }
+
+    BOOST_AUTO_TEST_CASE(keys_are_traversed_in_order_together_with_their_values)
+    {
+        burst::k_ary_search_map<int, char, std::greater<int>, burst::container::cache_aligned_nodes>
+            map({{1, 'a'}, {5, 'e'}, {3, 'c'}, {2, 'b'}, {4, 'd'}}, 3);
+
+        std::string values;
+        for (auto key = map.keys().ordered_begin(); key != map.keys().ordered_end(); ++key)
+        {
+            values.push_back(map.mapped(key.index()));
+        }
+
+        BOOST_CHECK_EQUAL(values, "edcba");
+    }
+BOOST_AUTO_TEST_SUITE_END()
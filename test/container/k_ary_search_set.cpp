@@ -4,7 +4,9 @@
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
 #include <numeric>
 #include <vector>
 
@@ -155,4 +157,243 @@ BOOST_AUTO_TEST_SUITE(k_ary_search)
         burst::k_ary_search_set<int> & set_ref = set;
         BOOST_CHECK(set_ref.find(8) == set_ref.end());
     }
+    BOOST_AUTO_TEST_CASE(cache_aligned_nodes_start_at_cache_line_boundary)
+    {
+        std::vector<std::int64_t> numbers(1000);
+        std::iota(numbers.begin(), numbers.end(), 0);
+
+        const auto arity = 5ul;
+        burst::k_ary_search_set<std::int64_t, std::less<std::int64_t>, burst::container::cache_aligned_nodes>
+            set(numbers.begin(), numbers.end(), arity);
+
+        for (auto node = set.begin(); node < set.end(); node += arity - 1)
+        {
+            BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(&*node) % 64, 0);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(cache_aligned_nodes_do_not_change_layout_order)
+    {
+        std::vector<int> numbers(500);
+        std::iota(numbers.begin(), numbers.end(), 0);
+
+        burst::k_ary_search_set<int> packed(numbers.begin(), numbers.end(), 7);
+        burst::k_ary_search_set<int, std::less<int>, burst::container::cache_aligned_nodes>
+            aligned(numbers.begin(), numbers.end(), 7);
+
+        BOOST_CHECK_EQUAL(aligned.size(), packed.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            aligned.begin(), aligned.end(),
+            packed.begin(), packed.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(every_element_is_found_in_cache_aligned_set)
+    {
+        std::vector<int> numbers(700);
+        std::generate(numbers.begin(), numbers.end(), [n = 0] () mutable { return n += 2; });
+
+        burst::k_ary_search_set<int, std::less<int>, burst::container::cache_aligned_nodes>
+            set(numbers.begin(), numbers.end(), 20);
+
+        for (auto value = 0; value < 1410; ++value)
+        {
+            const auto found = set.find(value);
+            if (value % 2 == 0 && value > 0 && value <= 1400)
+            {
+                BOOST_REQUIRE(found != set.end());
+                BOOST_CHECK_EQUAL(*found, value);
+            }
+            else
+            {
+                BOOST_CHECK(found == set.end());
+            }
+        }
+    }
+    BOOST_AUTO_TEST_CASE(find_batch_finds_the_same_as_find)
+    {
+        std::vector<int> numbers(1000);
+        std::generate(numbers.begin(), numbers.end(), [n = 0] () mutable { return n += 3; });
+        burst::k_ary_search_set<int> set(numbers.begin(), numbers.end(), 5);
+
+        std::vector<int> keys(100);
+        std::generate(keys.begin(), keys.end(), [n = 0] () mutable { return n += 31; });
+
+        std::vector<burst::k_ary_search_set<int>::const_iterator> found;
+        set.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+
+        BOOST_REQUIRE_EQUAL(found.size(), keys.size());
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            BOOST_CHECK(found[i] == set.find(keys[i]));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(find_batch_returns_end_for_every_key_in_empty_set)
+    {
+        burst::k_ary_search_set<int> set;
+
+        const auto keys = {1, 2, 3};
+        std::vector<burst::k_ary_search_set<int>::const_iterator> found(keys.size());
+        const auto found_end = set.find_batch(keys.begin(), keys.end(), found.begin());
+
+        BOOST_CHECK(found_end == found.end());
+        BOOST_CHECK(std::all_of(found.begin(), found.end(), [& set] (auto i) { return i == set.end(); }));
+    }
+
+    BOOST_AUTO_TEST_CASE(find_batch_works_with_cache_aligned_nodes)
+    {
+        std::vector<std::int64_t> numbers(5000);
+        std::iota(numbers.begin(), numbers.end(), 0);
+        burst::k_ary_search_set<std::int64_t, std::less<std::int64_t>, burst::container::cache_aligned_nodes>
+            set(numbers.begin(), numbers.end(), 7);
+
+        std::vector<std::int64_t> keys{4999, 5000, -1, 0, 17, 2500};
+        std::vector<decltype(set)::const_iterator> found;
+        set.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+
+        BOOST_REQUIRE_EQUAL(found.size(), keys.size());
+        BOOST_CHECK_EQUAL(*found[0], 4999);
+        BOOST_CHECK(found[1] == set.end());
+        BOOST_CHECK(found[2] == set.end());
+        BOOST_CHECK_EQUAL(*found[3], 0);
+        BOOST_CHECK_EQUAL(*found[4], 17);
+        BOOST_CHECK_EQUAL(*found[5], 2500);
+    }
+    BOOST_AUTO_TEST_CASE(ordered_traversal_visits_elements_in_ascending_order)
+    {
+        for (std::size_t arity = 2; arity < 7; ++arity)
+        {
+            for (auto size = 0; size < 150; ++size)
+            {
+                std::vector<int> numbers(static_cast<std::size_t>(size));
+                std::iota(numbers.begin(), numbers.end(), 0);
+
+                burst::k_ary_search_set<int> set(numbers.begin(), numbers.end(), arity);
+
+                BOOST_CHECK_EQUAL_COLLECTIONS
+                (
+                    set.ordered_begin(), set.ordered_end(),
+                    numbers.begin(), numbers.end()
+                );
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ordered_traversal_can_be_done_backwards)
+    {
+        std::vector<int> numbers(200);
+        std::iota(numbers.begin(), numbers.end(), 0);
+
+        burst::k_ary_search_set<int, std::less<int>, burst::container::cache_aligned_nodes>
+            set(numbers.begin(), numbers.end(), 4);
+
+        std::vector<int> backwards;
+        for (auto i = set.ordered_end(); i != set.ordered_begin(); /* пусто */)
+        {
+            --i;
+            backwards.push_back(*i);
+        }
+
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            backwards.begin(), backwards.end(),
+            numbers.rbegin(), numbers.rend()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(ordered_traversal_of_empty_set_is_empty)
+    {
+        burst::k_ary_search_set<int> set;
+        BOOST_CHECK(set.ordered_begin() == set.ordered_end());
+        BOOST_CHECK(set.lower_bound(1) == set.ordered_end());
+    }
+
+    BOOST_AUTO_TEST_CASE(bounds_are_the_same_as_for_sorted_sequence)
+    {
+        std::vector<int> numbers(300);
+        std::generate(numbers.begin(), numbers.end(), [n = 0] () mutable { return n += 3; });
+
+        for (std::size_t arity = 2; arity < 10; arity += 3)
+        {
+            burst::k_ary_search_set<int> set(numbers.begin(), numbers.end(), arity);
+
+            for (auto value = 0; value < 905; ++value)
+            {
+                const auto expected_lower = std::lower_bound(numbers.begin(), numbers.end(), value);
+                const auto expected_upper = std::upper_bound(numbers.begin(), numbers.end(), value);
+
+                BOOST_CHECK_EQUAL
+                (
+                    std::distance(set.ordered_begin(), set.lower_bound(value)),
+                    std::distance(numbers.begin(), expected_lower)
+                );
+                BOOST_CHECK_EQUAL
+                (
+                    std::distance(set.ordered_begin(), set.upper_bound(value)),
+                    std::distance(numbers.begin(), expected_upper)
+                );
+
+                const auto range = set.equal_range(value);
+                BOOST_CHECK_EQUAL(std::distance(range.first, range.second), std::distance(expected_lower, expected_upper));
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(range_between_bounds_contains_all_elements_of_interval)
+    {
+        burst::k_ary_search_set<int, std::greater<int>> set({10, 1, 7, 3, 9, 4, 6, 2, 8, 5}, 3);
+
+        const auto expected = {7, 6, 5, 4};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            set.lower_bound(7), set.lower_bound(3),
+            expected.begin(), expected.end()
+        );
+    }
+    BOOST_AUTO_TEST_CASE(parallel_construction_results_the_same_layout_as_serial)
+    {
+        for (std::size_t arity = 2; arity < 12; arity += 3)
+        {
+            for (auto size = 0; size < 400; size += 13)
+            {
+                std::vector<int> numbers(static_cast<std::size_t>(size));
+                std::iota(numbers.begin(), numbers.end(), 0);
+
+                burst::k_ary_search_set<int> serial(numbers.begin(), numbers.end(), arity);
+                for (std::size_t threads = 1; threads < 6; ++threads)
+                {
+                    burst::k_ary_search_set<int> parallel
+                    (
+                        burst::container::parallel(threads),
+                        burst::container::unique_ordered_tag,
+                        numbers.begin(), numbers.end(),
+                        arity
+                    );
+
+                    BOOST_CHECK_EQUAL_COLLECTIONS
+                    (
+                        parallel.begin(), parallel.end(),
+                        serial.begin(), serial.end()
+                    );
+                }
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(parallel_construction_sorts_unordered_input)
+    {
+        auto numbers = burst::make_vector({5, 3, 9, 1, 3, 7, 2});
+
+        burst::k_ary_search_set<int, std::less<int>, burst::container::cache_aligned_nodes>
+            set(burst::container::parallel(3), numbers.begin(), numbers.end(), 3);
+
+        const auto expected = {1, 2, 3, 5, 7, 9};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            set.ordered_begin(), set.ordered_end(),
+            expected.begin(), expected.end()
+        );
+    }
 BOOST_AUTO_TEST_SUITE_END()
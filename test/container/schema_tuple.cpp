@@ -0,0 +1,133 @@
+#include <burst/container/schema_tuple.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(schema_tuple)
+    struct counted
+    {
+        counted ()
+        {
+            ++instances_count;
+        }
+
+        counted (const counted &)
+        {
+            ++instances_count;
+        }
+
+        ~counted ()
+        {
+            --instances_count;
+        }
+
+        static int instances_count;
+    };
+
+    int counted::instances_count = 0;
+
+    struct throws_on_copy
+    {
+        throws_on_copy () = default;
+
+        throws_on_copy (const throws_on_copy &)
+        {
+            throw std::runtime_error("copy");
+        }
+    };
+
+    BOOST_AUTO_TEST_CASE(tuple_holds_objects_of_its_schema)
+    {
+        const auto schema = burst::make_dynamic_tuple_schema<int, std::string, double>();
+        const burst::schema_tuple t(schema, 42, std::string("qwe"), 3.14);
+
+        BOOST_CHECK_EQUAL(t.size(), 3);
+        BOOST_CHECK_EQUAL(t.get<int>(0), 42);
+        BOOST_CHECK_EQUAL(t.get<std::string>(1), "qwe");
+        BOOST_CHECK_EQUAL(t.get<double>(2), 3.14);
+        BOOST_CHECK(t.type(1) == typeid(std::string));
+    }
+
+    BOOST_AUTO_TEST_CASE(tuples_of_one_schema_share_it_and_its_offsets)
+    {
+        const auto schema = burst::make_dynamic_tuple_schema<char, double>();
+
+        std::vector<burst::schema_tuple> rows;
+        for (auto i = 0; i < 10; ++i)
+        {
+            rows.emplace_back(schema, static_cast<char>('a' + i), i * 0.5);
+        }
+
+        const auto offset = schema->offset(1);
+        for (auto i = 0u; i < rows.size(); ++i)
+        {
+            BOOST_CHECK(rows[i].schema() == schema);
+            BOOST_CHECK_EQUAL(rows[i].get_by_offset<double>(offset), i * 0.5);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(copy_is_independent_of_original)
+    {
+        const auto schema = burst::make_dynamic_tuple_schema<int, std::vector<int>>();
+        burst::schema_tuple t(schema, 1, std::vector<int>{1, 2, 3});
+        const auto u = t;
+
+        t.get<int>(0) = 2;
+        t.get<std::vector<int>>(1).push_back(4);
+
+        BOOST_CHECK_EQUAL(u.get<int>(0), 1);
+        BOOST_CHECK_EQUAL(u.get<std::vector<int>>(1).size(), 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(trivially_copyable_tuple_is_copied_and_assigned)
+    {
+        const auto schema = burst::make_dynamic_tuple_schema<int, double>();
+        burst::schema_tuple t(schema, 1, 2.5);
+        burst::schema_tuple u(schema, 0, 0.0);
+
+        u = t;
+        t.get<int>(0) = 7;
+
+        BOOST_CHECK_EQUAL(u.get<int>(0), 1);
+        BOOST_CHECK_EQUAL(u.get<double>(1), 2.5);
+    }
+
+    BOOST_AUTO_TEST_CASE(objects_are_destroyed_exactly_once)
+    {
+        {
+            const auto schema = burst::make_dynamic_tuple_schema<counted, int>();
+            burst::schema_tuple t(schema, counted{}, 1);
+            const auto u = t;
+            auto v = std::move(t);
+            BOOST_CHECK_EQUAL(counted::instances_count, 2);
+        }
+        BOOST_CHECK_EQUAL(counted::instances_count, 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(moved_from_tuple_can_be_copied_and_assigned_anew)
+    {
+        const auto schema = burst::make_dynamic_tuple_schema<counted, int>();
+        burst::schema_tuple t(schema, counted{}, 1);
+        const auto u = std::move(t);
+
+        const auto v = t;
+        BOOST_CHECK(v.schema() == nullptr);
+
+        t = u;
+        BOOST_CHECK_EQUAL(t.get<int>(1), 1);
+        BOOST_CHECK_EQUAL(counted::instances_count, 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(constructed_objects_are_destroyed_if_construction_throws)
+    {
+        const auto schema = burst::make_dynamic_tuple_schema<counted, throws_on_copy>();
+        const throws_on_copy thrower{};
+
+        BOOST_CHECK_THROW(burst::schema_tuple(schema, counted{}, thrower), std::runtime_error);
+        BOOST_CHECK_EQUAL(counted::instances_count, 0);
+    }
+BOOST_AUTO_TEST_SUITE_END()
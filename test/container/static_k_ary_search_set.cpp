@@ -0,0 +1,124 @@
+#include <burst/container/k_ary_search_set.hpp>
+#include <burst/container/static_k_ary_search_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(static_k_ary_search)
+    BOOST_AUTO_TEST_CASE(static_k_ary_search_set_initialized_with_default_constructor_is_empty)
+    {
+        burst::static_k_ary_search_set<int> set;
+
+        BOOST_CHECK(set.empty());
+        BOOST_CHECK_EQUAL(set.size(), 0);
+        BOOST_CHECK(set.begin() == set.end());
+        BOOST_CHECK(set.find(17) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(default_node_fits_cache_line)
+    {
+        BOOST_CHECK_EQUAL((burst::static_k_ary_search_set<std::uint32_t>::arity), 17);
+        BOOST_CHECK_EQUAL((burst::static_k_ary_search_set<std::int64_t>::arity), 9);
+    }
+
+    BOOST_AUTO_TEST_CASE(layout_is_the_same_as_of_k_ary_search_set_with_same_arity)
+    {
+        std::vector<int> numbers(100);
+        std::iota(numbers.begin(), numbers.end(), 0);
+
+        burst::static_k_ary_search_set<int, 3> static_set(numbers.begin(), numbers.end());
+        burst::k_ary_search_set<int> dynamic_set(numbers.begin(), numbers.end(), 3);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            static_set.begin(), static_set.end(),
+            dynamic_set.begin(), dynamic_set.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(unordered_input_is_sorted_and_made_unique)
+    {
+        burst::static_k_ary_search_set<int, 3> set({5, 1, 3, 1, 4, 2, 5});
+
+        burst::k_ary_search_set<int> expected(burst::container::unique_ordered_tag, {1, 2, 3, 4, 5}, 3);
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            set.begin(), set.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(every_element_is_found_and_nothing_else)
+    {
+        for (std::uint32_t size = 0; size < 300; size += 7)
+        {
+            std::vector<std::uint32_t> numbers(size);
+            std::generate(numbers.begin(), numbers.end(), [n = 0u] () mutable { return n += 3; });
+
+            burst::static_k_ary_search_set<std::uint32_t> set(burst::container::unique_ordered_tag, numbers.begin(), numbers.end());
+            BOOST_REQUIRE_EQUAL(set.size(), numbers.size());
+
+            for (std::uint32_t value = 0; value < 3 * size + 5; ++value)
+            {
+                const auto found = set.find(value);
+                if (std::binary_search(numbers.begin(), numbers.end(), value))
+                {
+                    BOOST_REQUIRE(found != set.end());
+                    BOOST_CHECK_EQUAL(*found, value);
+                }
+                else
+                {
+                    BOOST_CHECK(found == set.end());
+                }
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(negative_and_extreme_values_are_found)
+    {
+        const auto min = std::numeric_limits<std::int64_t>::min();
+        const auto max = std::numeric_limits<std::int64_t>::max();
+        burst::static_k_ary_search_set<std::int64_t> set({min, -100, -1, 0, 1, 100, max});
+
+        for (auto value: {min, std::int64_t{-100}, std::int64_t{-1}, std::int64_t{0}, std::int64_t{1}, std::int64_t{100}, max})
+        {
+            BOOST_REQUIRE(set.find(value) != set.end());
+            BOOST_CHECK_EQUAL(*set.find(value), value);
+        }
+        BOOST_CHECK(set.find(-2) == set.end());
+        BOOST_CHECK(set.find(2) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(greatest_value_of_type_is_not_found_unless_inserted)
+    {
+        const auto max = std::numeric_limits<std::uint32_t>::max();
+        burst::static_k_ary_search_set<std::uint32_t> set({1, 2, 3});
+
+        BOOST_CHECK(set.find(max) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(unsigned_values_with_high_bit_set_are_ordered_properly)
+    {
+        const auto high = std::uint32_t{1} << 31;
+        std::vector<std::uint32_t> numbers;
+        for (std::uint32_t i = 0; i < 50; ++i)
+        {
+            numbers.push_back(i);
+            numbers.push_back(high + i);
+        }
+
+        burst::static_k_ary_search_set<std::uint32_t> set(numbers.begin(), numbers.end());
+
+        for (auto value: numbers)
+        {
+            BOOST_REQUIRE(set.find(value) != set.end());
+            BOOST_CHECK_EQUAL(*set.find(value), value);
+        }
+        BOOST_CHECK(set.find(high + 50) == set.end());
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+#include <burst/container/eytzinger_layout.hpp>
+#include <burst/container/k_ary_layout.hpp>
+#include <burst/container/s_tree_layout.hpp>
+#include <burst/container/static_search_set.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    template <typename Layout>
+    void check_every_element_is_found_and_nothing_else ()
+    {
+        for (std::uint32_t size = 0; size < 600; size += 13)
+        {
+            std::vector<std::uint32_t> numbers(size);
+            std::generate(numbers.begin(), numbers.end(), [n = 0u] () mutable { return n += 3; });
+
+            burst::static_search_set<std::uint32_t, Layout> set(burst::container::unique_ordered_tag, numbers.begin(), numbers.end());
+            BOOST_REQUIRE_EQUAL(set.size(), numbers.size());
+
+            for (std::uint32_t value = 0; value < 3 * size + 5; ++value)
+            {
+                const auto found = set.find(value);
+                if (std::binary_search(numbers.begin(), numbers.end(), value))
+                {
+                    BOOST_REQUIRE(found != set.end());
+                    BOOST_CHECK_EQUAL(*found, value);
+                }
+                else
+                {
+                    BOOST_CHECK(found == set.end());
+                }
+            }
+        }
+    }
+
+    template <typename Layout>
+    void check_custom_order_is_respected ()
+    {
+        burst::static_search_set<std::string, Layout, std::greater<std::string>> set({"qwe", "asd", "zxc", "asd", "rty"});
+
+        BOOST_CHECK_EQUAL(set.size(), 4);
+        BOOST_CHECK(set.find("zxc") != set.end());
+        BOOST_CHECK(set.find("asd") != set.end());
+        BOOST_CHECK(set.find("fgh") == set.end());
+        BOOST_CHECK(set.find("zzz") == set.end());
+        BOOST_CHECK(set.find("aaa") == set.end());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(static_search)
+    BOOST_AUTO_TEST_CASE(static_search_set_initialized_with_default_constructor_is_empty)
+    {
+        burst::static_search_set<int> set;
+
+        BOOST_CHECK(set.empty());
+        BOOST_CHECK_EQUAL(set.size(), 0);
+        BOOST_CHECK(set.begin() == set.end());
+        BOOST_CHECK(set.find(17) == set.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(default_layout_is_eytzinger)
+    {
+        BOOST_CHECK((std::is_same<burst::static_search_set<int>::layout_type, burst::container::eytzinger_layout>::value));
+    }
+
+    BOOST_AUTO_TEST_CASE(eytzinger_layout_stores_elements_in_breadth_first_order)
+    {
+        burst::static_search_set<int, burst::container::eytzinger_layout> set({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+
+        const auto expected = {7, 4, 9, 2, 6, 8, 10, 1, 3, 5};
+        BOOST_CHECK_EQUAL_COLLECTIONS(set.begin(), set.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(s_tree_layout_iterates_in_ascending_order)
+    {
+        burst::static_search_set<int, burst::container::s_tree_layout<2>> set({5, 1, 3, 1, 4, 2, 5});
+
+        const auto expected = {1, 2, 3, 4, 5};
+        BOOST_CHECK_EQUAL_COLLECTIONS(set.begin(), set.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(k_ary_layout_is_the_same_as_of_k_ary_search_set_with_same_arity)
+    {
+        std::vector<int> numbers(100);
+        std::generate(numbers.begin(), numbers.end(), [n = 0] () mutable { return n++; });
+
+        burst::static_search_set<int, burst::container::k_ary_layout<3>> set(numbers.begin(), numbers.end());
+        burst::k_ary_search_set<int> expected(numbers.begin(), numbers.end(), 3);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(set.begin(), set.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(eytzinger_layout_finds_every_element_and_nothing_else)
+    {
+        check_every_element_is_found_and_nothing_else<burst::container::eytzinger_layout>();
+    }
+
+    BOOST_AUTO_TEST_CASE(s_tree_layout_finds_every_element_and_nothing_else)
+    {
+        check_every_element_is_found_and_nothing_else<burst::container::s_tree_layout<>>();
+        check_every_element_is_found_and_nothing_else<burst::container::s_tree_layout<3>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(k_ary_layout_finds_every_element_and_nothing_else)
+    {
+        check_every_element_is_found_and_nothing_else<burst::container::k_ary_layout<17>>();
+        check_every_element_is_found_and_nothing_else<burst::container::k_ary_layout<17, burst::container::cache_aligned_nodes>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(eytzinger_layout_respects_custom_order)
+    {
+        check_custom_order_is_respected<burst::container::eytzinger_layout>();
+    }
+
+    BOOST_AUTO_TEST_CASE(s_tree_layout_respects_custom_order)
+    {
+        check_custom_order_is_respected<burst::container::s_tree_layout<2>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(k_ary_layout_respects_custom_order)
+    {
+        check_custom_order_is_respected<burst::container::k_ary_layout<3>>();
+    }
+BOOST_AUTO_TEST_SUITE_END()
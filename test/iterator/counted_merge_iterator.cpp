@@ -0,0 +1,26 @@
+#include <burst/iterator/counted_merge_iterator.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(counted_merge_iterator)
+    BOOST_AUTO_TEST_CASE(counted_merge_iterator_end_is_created_using_special_tag)
+    {
+        auto  first = {1, 2, 2};
+        auto second = {2, 3};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto merged_begin = burst::make_counted_merge_iterator(boost::make_iterator_range(ranges));
+        auto merged_end = burst::make_counted_merge_iterator(merged_begin, burst::iterator::end_tag);
+
+        auto expected =
+            std::vector<std::pair<int, std::size_t>>{{1, 1}, {2, 3}, {3, 1}};
+        auto actual = std::vector<std::pair<int, std::size_t>>(merged_begin, merged_end);
+        BOOST_CHECK(actual == expected);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,7 @@
 
 #include <forward_list>
 #include <iterator>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(difference_iterator)
     BOOST_AUTO_TEST_CASE(difference_iterator_end_is_created_using_special_tag)
@@ -65,4 +66,28 @@ BOOST_AUTO_TEST_SUITE(difference_iterator)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(next_batch_writes_consecutive_difference_elements)
+    {
+        const auto first = {1, 2, 3, 4, 5, 6, 7};
+        const auto second = {3, 6};
+
+        auto difference_begin =
+            burst::make_difference_iterator
+            (
+                boost::make_iterator_range(first),
+                boost::make_iterator_range(second)
+            );
+        const auto difference_end =
+            burst::make_difference_iterator(difference_begin, burst::iterator::end_tag);
+
+        std::vector<int> batch(3);
+        BOOST_CHECK(difference_begin.next_batch(batch.begin(), batch.end()) == batch.end());
+        BOOST_CHECK((batch == std::vector<int>{1, 2, 4}));
+
+        auto batch_end = difference_begin.next_batch(batch.begin(), batch.end());
+        BOOST_CHECK(batch_end == batch.begin() + 2);
+        BOOST_CHECK((std::vector<int>(batch.begin(), batch_end) == std::vector<int>{5, 7}));
+        BOOST_CHECK(difference_begin == difference_end);
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -4,6 +4,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <iterator>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(intersect_iterator)
     BOOST_AUTO_TEST_CASE(intersect_iterator_end_is_created_using_special_tag)
@@ -24,4 +25,23 @@ BOOST_AUTO_TEST_SUITE(intersect_iterator)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(next_batch_writes_consecutive_intersected_elements)
+    {
+        auto  first = {1, 2, 3, 4, 5, 6};
+        auto second = {0, 2, 4, 5, 6, 7};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto intersected_begin = burst::make_intersect_iterator(boost::make_iterator_range(ranges));
+        auto intersected_end = burst::make_intersect_iterator(intersected_begin, burst::iterator::end_tag);
+
+        std::vector<int> batch(3);
+        BOOST_CHECK(intersected_begin.next_batch(batch.begin(), batch.end()) == batch.end());
+        BOOST_CHECK((batch == std::vector<int>{2, 4, 5}));
+
+        auto batch_end = intersected_begin.next_batch(batch.begin(), batch.end());
+        BOOST_CHECK(batch_end == batch.begin() + 1);
+        BOOST_CHECK_EQUAL(batch.front(), 6);
+        BOOST_CHECK(intersected_begin == intersected_end);
+    }
 BOOST_AUTO_TEST_SUITE_END()
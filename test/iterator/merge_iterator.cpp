@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <iterator>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(merge_iterator)
     BOOST_AUTO_TEST_CASE(merge_iterator_end_is_created_using_special_tag)
@@ -23,4 +24,27 @@ BOOST_AUTO_TEST_SUITE(merge_iterator)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(next_batch_writes_consecutive_merged_elements)
+    {
+        auto  first = {1, 2, 3, 7, 8};
+        auto second = {4, 5, 6, 9};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto merged_begin = burst::make_merge_iterator(boost::make_iterator_range(ranges));
+        auto merged_end = burst::make_merge_iterator(merged_begin, burst::iterator::end_tag);
+
+        std::vector<int> batch(4);
+        BOOST_CHECK(merged_begin.next_batch(batch.begin(), batch.end()) == batch.end());
+        BOOST_CHECK((batch == std::vector<int>{1, 2, 3, 4}));
+
+        auto batch_end = merged_begin.next_batch(batch.begin(), batch.end());
+        BOOST_CHECK(batch_end == batch.end());
+        BOOST_CHECK((batch == std::vector<int>{5, 6, 7, 8}));
+
+        batch_end = merged_begin.next_batch(batch.begin(), batch.end());
+        BOOST_CHECK(batch_end == batch.begin() + 1);
+        BOOST_CHECK_EQUAL(batch.front(), 9);
+        BOOST_CHECK(merged_begin == merged_end);
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,59 @@
+#include <burst/container/make_forward_list.hpp>
+#include <burst/iterator/multidifference_iterator.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <forward_list>
+#include <iterator>
+
+BOOST_AUTO_TEST_SUITE(multidifference_iterator)
+    BOOST_AUTO_TEST_CASE(multidifference_iterator_end_is_created_using_special_tag)
+    {
+        const auto first = {1, 2, 2, 3, 4, 5};
+        const auto second = {0, 2, 2};
+        const auto third = {4, 6};
+        auto subtrahends = burst::make_range_vector(second, third);
+
+        const auto difference_begin =
+            burst::make_multidifference_iterator
+            (
+                boost::make_iterator_range(first),
+                boost::make_iterator_range(subtrahends)
+            );
+        const auto difference_end =
+            burst::make_multidifference_iterator(difference_begin, burst::iterator::end_tag);
+
+        const auto expected_collection = {1, 3, 5};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference_begin, difference_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(multidifference_iterator_accepts_forward_iterator)
+    {
+        const auto first = burst::make_forward_list({3, 5, 7});
+        const auto second = burst::make_forward_list({1, 2, 3});
+        const auto third = burst::make_forward_list({7, 8});
+        auto subtrahends = burst::make_range_vector(second, third);
+
+        const auto difference_begin =
+            burst::make_multidifference_iterator
+            (
+                boost::make_iterator_range(first),
+                boost::make_iterator_range(subtrahends)
+            );
+        const auto difference_end =
+            burst::make_multidifference_iterator(difference_begin, burst::iterator::end_tag);
+
+        auto expected_collection = {5};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference_begin, difference_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
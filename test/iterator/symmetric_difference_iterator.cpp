@@ -0,0 +1,28 @@
+#include <burst/iterator/symmetric_difference_iterator.hpp>
+#include <burst/range/make_range_vector.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <iterator>
+
+BOOST_AUTO_TEST_SUITE(symmetric_difference_iterator)
+    BOOST_AUTO_TEST_CASE(symmetric_difference_iterator_end_is_created_using_special_tag)
+    {
+        auto  first = {1, 2, 3};
+        auto second = {0, 2, 4};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto difference_begin =
+            burst::make_symmetric_difference_iterator(boost::make_iterator_range(ranges));
+        auto difference_end =
+            burst::make_symmetric_difference_iterator(difference_begin, burst::iterator::end_tag);
+
+        auto expected_collection = {0, 1, 3, 4};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference_begin, difference_end,
+            std::begin(expected_collection), std::end(expected_collection)
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
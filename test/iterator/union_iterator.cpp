@@ -6,6 +6,7 @@
 
 #include <forward_list>
 #include <iterator>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(union_iterator)
     BOOST_AUTO_TEST_CASE(union_iterator_end_is_created_using_special_tag)
@@ -40,4 +41,25 @@ BOOST_AUTO_TEST_SUITE(union_iterator)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(next_batch_writes_consecutive_united_elements)
+    {
+        auto  first = {1, 2, 3};
+        auto second = {2, 3, 4};
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto union_begin = burst::make_union_iterator(boost::make_iterator_range(ranges));
+        auto union_end = burst::make_union_iterator(union_begin, burst::iterator::end_tag);
+
+        std::vector<int> batch(10);
+        auto batch_end = union_begin.next_batch(batch.begin(), batch.end());
+
+        auto expected = {1, 2, 3, 4};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            batch.begin(), batch_end,
+            std::begin(expected), std::end(expected)
+        );
+        BOOST_CHECK(union_begin == union_end);
+    }
 BOOST_AUTO_TEST_SUITE_END()
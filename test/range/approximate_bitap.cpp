@@ -0,0 +1,69 @@
+#include <burst/range/approximate_bitap.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(approximate_bitap)
+    BOOST_AUTO_TEST_CASE(no_matches_in_an_empty_text)
+    {
+        const std::string pattern("образец");
+        const std::string text;
+
+        const auto matches = burst::approximate_bitap<std::uint32_t>(pattern, 1, text);
+        BOOST_CHECK(matches.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(all_fuzzy_occurrences_are_found_with_their_error_counts)
+    {
+        const std::string pattern("request_id");
+        const std::string text("request_id=1 requestid=2 reqest_ib=3 request_id=4");
+
+        std::vector<std::size_t> errors;
+        for (const auto & match: burst::approximate_bitap<std::uint16_t>(pattern, 2, text))
+        {
+            const auto end = static_cast<std::size_t>(match.range.end() - text.begin());
+            if (match.errors == 0 || text[end] == '=')
+            {
+                errors.push_back(match.errors);
+            }
+        }
+
+        const std::vector<std::size_t> expected{0, 1, 2, 0};
+        BOOST_CHECK_EQUAL_COLLECTIONS(errors.begin(), errors.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(hamming_matches_are_ranges_of_text)
+    {
+        const std::string pattern("error");
+        const std::string text("errors, eror, arrow, mirror");
+
+        std::vector<std::string> matches;
+        for (const auto & match: burst::approximate_bitap<std::uint8_t, burst::algorithm::hamming_distance>(pattern, 1, text))
+        {
+            matches.emplace_back(match.range.begin(), match.range.end());
+        }
+
+        const std::vector<std::string> expected{"error", "irror"};
+        BOOST_CHECK_EQUAL_COLLECTIONS(matches.begin(), matches.end(), expected.begin(), expected.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(works_with_forward_ranges)
+    {
+        const std::string pattern("abc");
+        const std::list<char> text{'x', 'a', 'x', 'c', 'y', 'a', 'b', 'c'};
+
+        std::vector<std::size_t> errors;
+        for (const auto & match: burst::approximate_bitap<std::uint8_t, burst::algorithm::hamming_distance>(pattern, 1, text))
+        {
+            errors.push_back(match.errors);
+        }
+
+        const std::vector<std::size_t> expected{1, 0};
+        BOOST_CHECK_EQUAL_COLLECTIONS(errors.begin(), errors.end(), expected.begin(), expected.end());
+    }
+BOOST_AUTO_TEST_SUITE_END()
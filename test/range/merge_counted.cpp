@@ -0,0 +1,65 @@
+#include <burst/container/make_vector.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/merge_counted.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(merge_counted)
+    BOOST_AUTO_TEST_CASE(counted_merge_of_empty_ranges_is_empty)
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto merged = burst::merge_counted(boost::make_iterator_range(ranges));
+
+        BOOST_CHECK(merged.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(each_element_is_paired_with_its_total_number_of_occurrences)
+    {
+        auto  first = {1, 1, 2,    4};
+        auto second = {1,    2, 3   };
+        auto  third = {      2, 3, 4};
+
+        auto ranges = burst::make_range_vector(first, second, third);
+        auto merged = burst::merge_counted(boost::make_iterator_range(ranges));
+
+        auto expected =
+            burst::make_vector
+            ({
+                std::make_pair(1, std::size_t{3}),
+                std::make_pair(2, std::size_t{3}),
+                std::make_pair(3, std::size_t{2}),
+                std::make_pair(4, std::size_t{2})
+            });
+        auto actual = std::vector<std::pair<int, std::size_t>>(merged.begin(), merged.end());
+        BOOST_CHECK(actual == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(counted_merge_supports_custom_ordering_and_forward_ranges)
+    {
+        std::list<char>  first{'c', 'b', 'b'};
+        std::list<char> second{'c',      'a'};
+
+        auto ranges = burst::make_range_vector(first, second);
+        auto merged = burst::merge_counted(boost::make_iterator_range(ranges), std::greater<>{});
+
+        auto expected =
+            burst::make_vector
+            ({
+                std::make_pair('c', std::size_t{2}),
+                std::make_pair('b', std::size_t{2}),
+                std::make_pair('a', std::size_t{1})
+            });
+        auto actual = std::vector<std::pair<char, std::size_t>>(merged.begin(), merged.end());
+        BOOST_CHECK(actual == expected);
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,127 @@
+#include <burst/container/make_vector.hpp>
+#include <burst/range/difference.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/multidifference.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(multidifference)
+    BOOST_AUTO_TEST_CASE(multidifference_is_set_of_elements_in_minuend_but_not_in_any_of_subtrahends)
+    {
+        const auto natural = burst::make_vector({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+        const auto    even = burst::make_vector({   2,    4,    6,    8,    10});
+        const auto   three = burst::make_vector({      3,       6,       9    });
+        //                                       ^           ^     ^
+        auto subtrahends = burst::make_range_vector(even, three);
+
+        const auto difference =
+            burst::multidifference
+            (
+                boost::make_iterator_range(natural),
+                boost::make_iterator_range(subtrahends)
+            );
+
+        const auto expected = burst::make_vector({1, 5, 7});
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference.begin(), difference.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(multidifference_with_no_subtrahends_is_minuend)
+    {
+        const auto minuend = burst::make_vector({1, 2, 2, 3});
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> subtrahends;
+
+        const auto difference =
+            burst::multidifference
+            (
+                boost::make_iterator_range(minuend),
+                boost::make_iterator_range(subtrahends)
+            );
+
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference.begin(), difference.end(),
+            minuend.begin(), minuend.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(multisets_are_subtracted_by_their_union)
+    {
+        const auto minuend = burst::make_vector({1, 1, 1, 1, 2, 2, 3});
+        const auto   first = burst::make_vector({1, 1,                });
+        const auto  second = burst::make_vector({1, 1, 1,    2        });
+        //                                                ^     ^  ^
+        auto subtrahends = burst::make_range_vector(first, second);
+
+        const auto difference =
+            burst::multidifference
+            (
+                boost::make_iterator_range(minuend),
+                boost::make_iterator_range(subtrahends)
+            );
+
+        const auto expected = burst::make_vector({1, 2, 3});
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference.begin(), difference.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(multidifference_with_one_subtrahend_is_equal_to_difference)
+    {
+        const auto    minuend = burst::make_vector({1, 1, 1, 2, 2, 3, 5, 8});
+        const auto subtrahend = burst::make_vector({0, 1, 1,    2, 4, 5   });
+        auto subtrahends = burst::make_range_vector(subtrahend);
+
+        const auto multidifference =
+            burst::multidifference
+            (
+                boost::make_iterator_range(minuend),
+                boost::make_iterator_range(subtrahends)
+            );
+        const auto difference =
+            burst::difference
+            (
+                boost::make_iterator_range(minuend),
+                boost::make_iterator_range(subtrahend)
+            );
+
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            multidifference.begin(), multidifference.end(),
+            difference.begin(), difference.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(multidifference_supports_custom_ordering)
+    {
+        const auto minuend = burst::make_vector({9, 7, 5, 3, 1});
+        const auto   first = burst::make_vector({8, 7, 6      });
+        const auto  second = burst::make_vector({      5, 4, 1});
+        //                                       ^        ^
+        auto subtrahends = burst::make_range_vector(first, second);
+
+        const auto difference =
+            burst::multidifference
+            (
+                boost::make_iterator_range(minuend),
+                boost::make_iterator_range(subtrahends),
+                std::greater<>{}
+            );
+
+        const auto expected = burst::make_vector({9, 3});
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference.begin(), difference.end(),
+            expected.begin(), expected.end()
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
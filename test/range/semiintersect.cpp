@@ -5,6 +5,7 @@
 #include <boost/range/iterator_range.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <functional>
 #include <iterator>
 #include <list>
@@ -265,4 +266,51 @@ BOOST_AUTO_TEST_SUITE(semiintersect)
             std::begin(expected_collection), std::end(expected_collection)
         );
     }
+
+    BOOST_AUTO_TEST_CASE(semiintersection_of_many_ranges_is_a_set_of_elements_found_in_min_items_ranges)
+    {
+        std::vector<std::vector<int>> collections(10);
+        for (std::size_t i = 0; i < collections.size(); ++i)
+        {
+            for (auto n = 0; n < 100; ++n)
+            {
+                if (n % static_cast<int>(i + 2) == 0)
+                {
+                    collections[i].push_back(n);
+                }
+            }
+        }
+
+        for (auto min_items = 1ul; min_items <= collections.size() + 1; ++min_items)
+        {
+            std::vector<boost::iterator_range<std::vector<int>::const_iterator>> ranges;
+            for (const auto & collection: collections)
+            {
+                ranges.push_back(boost::make_iterator_range(collection));
+            }
+
+            auto semiintersection = burst::semiintersect(boost::make_iterator_range(ranges), min_items);
+
+            std::vector<int> expected;
+            for (auto n = 0; n < 100; ++n)
+            {
+                auto occurrences =
+                    std::count_if(collections.begin(), collections.end(),
+                        [n] (const auto & collection)
+                        {
+                            return std::binary_search(collection.begin(), collection.end(), n);
+                        });
+                if (static_cast<std::size_t>(occurrences) >= min_items)
+                {
+                    expected.push_back(n);
+                }
+            }
+
+            BOOST_CHECK_EQUAL_COLLECTIONS
+            (
+                std::begin(semiintersection), std::end(semiintersection),
+                std::begin(expected), std::end(expected)
+            );
+        }
+    }
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,94 @@
+#include <burst/container/make_vector.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/symmetric_difference.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(symmetric_difference)
+    BOOST_AUTO_TEST_CASE(symmetric_difference_of_empty_ranges_is_empty)
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+        auto ranges = burst::make_range_vector(first, second);
+
+        auto difference = burst::symmetric_difference(boost::make_iterator_range(ranges));
+
+        BOOST_CHECK(difference.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(symmetric_difference_of_two_sets_is_equal_to_std_set_symmetric_difference)
+    {
+        auto  first = burst::make_vector({1, 2,    4, 5,    7});
+        auto second = burst::make_vector({   2, 3,    5, 6   });
+
+        auto ranges = burst::make_range_vector(first, second);
+        auto difference = burst::symmetric_difference(boost::make_iterator_range(ranges));
+
+        std::vector<int> expected;
+        std::set_symmetric_difference(first.begin(), first.end(), second.begin(), second.end(),
+            std::back_inserter(expected));
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference.begin(), difference.end(),
+            expected.begin(), expected.end()
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(symmetric_difference_consists_of_elements_found_in_odd_number_of_ranges)
+    {
+        auto  first = {1, 2, 3,    5};
+        auto second = {   2, 3, 4   };
+        auto  third = {      3, 4, 5};
+        //             ^     ^
+
+        auto ranges = burst::make_range_vector(first, second, third);
+        auto difference = burst::symmetric_difference(boost::make_iterator_range(ranges));
+
+        auto expected = {1, 3};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference.begin(), difference.end(),
+            std::begin(expected), std::end(expected)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(repeats_inside_one_range_are_counted_once)
+    {
+        auto  first = {1, 1, 1, 2};
+        auto second = {      1, 2, 2, 3};
+        //                               ^
+
+        auto ranges = burst::make_range_vector(first, second);
+        auto difference = burst::symmetric_difference(boost::make_iterator_range(ranges));
+
+        auto expected = {3};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference.begin(), difference.end(),
+            std::begin(expected), std::end(expected)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(symmetric_difference_supports_custom_ordering)
+    {
+        auto  first = {5, 3, 1};
+        auto second = {4, 3, 2};
+
+        auto ranges = burst::make_range_vector(first, second);
+        auto difference =
+            burst::symmetric_difference(boost::make_iterator_range(ranges), std::greater<>{});
+
+        auto expected = {5, 4, 2, 1};
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            difference.begin(), difference.end(),
+            std::begin(expected), std::end(expected)
+        );
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,180 @@
+#include <burst/container/make_vector.hpp>
+#include <burst/iterator/weighted_semiintersect_iterator.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/range/semiintersect.hpp>
+#include <burst/range/weighted_semiintersect.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(weighted_semiintersect)
+    BOOST_AUTO_TEST_CASE(weighted_semiintersection_of_empty_ranges_is_empty)
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+        auto ranges = burst::make_range_vector(first, second);
+        auto weights = burst::make_vector({1, 1});
+
+        auto semiintersection =
+            burst::weighted_semiintersect
+            (
+                boost::make_iterator_range(ranges),
+                boost::make_iterator_range(weights),
+                0
+            );
+
+        BOOST_CHECK(semiintersection.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(weighted_semiintersection_with_unit_weights_equals_semiintersection)
+    {
+        auto  first = {0, 0, 1,       2};
+        auto second = {0,    1, 1      };
+        auto  third = {      1, 1, 1, 2};
+
+        auto ranges = burst::make_range_vector(first, second, third);
+        auto weights = burst::make_vector({1, 1, 1});
+        auto weighted =
+            burst::weighted_semiintersect
+            (
+                boost::make_iterator_range(ranges),
+                boost::make_iterator_range(weights),
+                2
+            );
+
+        std::vector<int> values;
+        for (const auto & item: weighted)
+        {
+            values.push_back(item.first);
+        }
+
+        auto other_ranges = burst::make_range_vector(first, second, third);
+        auto semiintersection = burst::semiintersect(boost::make_iterator_range(other_ranges), 2);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS
+        (
+            std::begin(values), std::end(values),
+            std::begin(semiintersection), std::end(semiintersection)
+        );
+    }
+
+    BOOST_AUTO_TEST_CASE(weight_of_an_element_is_a_sum_of_weights_of_ranges_containing_it)
+    {
+        auto  first = {1, 2, 3,    5};
+        auto second = {   2,    4, 5};
+        auto  third = {      3, 4, 5};
+
+        auto ranges = burst::make_range_vector(first, second, third);
+        auto weights = burst::make_vector({1.0, 2.0, 4.0});
+        auto weighted =
+            burst::weighted_semiintersect
+            (
+                boost::make_iterator_range(ranges),
+                boost::make_iterator_range(weights),
+                4.0
+            );
+
+        auto expected =
+            burst::make_vector
+            ({
+                std::make_pair(3, 5.0),
+                std::make_pair(4, 6.0),
+                std::make_pair(5, 7.0)
+            });
+        auto actual = std::vector<std::pair<int, double>>(weighted.begin(), weighted.end());
+        BOOST_CHECK(actual == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(threshold_greater_than_total_weight_results_empty_range)
+    {
+        auto  first = {1, 2, 3};
+        auto second = {1, 2, 3};
+
+        auto ranges = burst::make_range_vector(first, second);
+        auto weights = burst::make_vector({1, 2});
+        auto weighted =
+            burst::weighted_semiintersect
+            (
+                boost::make_iterator_range(ranges),
+                boost::make_iterator_range(weights),
+                4
+            );
+
+        BOOST_CHECK(weighted.empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(weighted_semiintersection_supports_custom_ordering)
+    {
+        auto  first = {5, 4, 3, 2, 1};
+        auto second = {   4,    2   };
+        auto  third = {5,    3      };
+
+        auto ranges = burst::make_range_vector(first, second, third);
+        auto weights = burst::make_vector({1u, 3u, 2u});
+        auto weighted =
+            burst::weighted_semiintersect
+            (
+                boost::make_iterator_range(ranges),
+                boost::make_iterator_range(weights),
+                4u,
+                std::greater<>{}
+            );
+
+        auto expected = burst::make_vector({std::make_pair(4, 4u), std::make_pair(2, 4u)});
+        auto actual = std::vector<std::pair<int, unsigned>>(weighted.begin(), weighted.end());
+        BOOST_CHECK(actual == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(raised_threshold_keeps_elements_with_weight_equal_to_threshold)
+    {
+        auto  first = {1, 2, 3, 4};
+        auto second = {   2, 3, 4};
+        auto  third = {         4};
+
+        auto ranges = burst::make_range_vector(first, second, third);
+        auto weights = burst::make_vector({1, 1, 1});
+        auto current =
+            burst::make_weighted_semiintersect_iterator
+            (
+                boost::make_iterator_range(ranges),
+                boost::make_iterator_range(weights),
+                1
+            );
+        const auto end = burst::make_weighted_semiintersect_iterator(current, burst::iterator::end_tag);
+
+        current.raise_threshold(2);
+        auto actual = std::vector<std::pair<int, int>>(current, end);
+
+        auto expected = burst::make_vector({std::make_pair(1, 1), std::make_pair(2, 2), std::make_pair(3, 2), std::make_pair(4, 3)});
+        BOOST_CHECK(actual == expected);
+    }
+
+    BOOST_AUTO_TEST_CASE(strictly_raised_threshold_skips_elements_with_weight_equal_to_threshold)
+    {
+        auto  first = {1, 2, 3, 4};
+        auto second = {   2, 3, 4};
+        auto  third = {         4};
+
+        auto ranges = burst::make_range_vector(first, second, third);
+        auto weights = burst::make_vector({1, 1, 1});
+        auto current =
+            burst::make_weighted_semiintersect_iterator
+            (
+                boost::make_iterator_range(ranges),
+                boost::make_iterator_range(weights),
+                1
+            );
+        const auto end = burst::make_weighted_semiintersect_iterator(current, burst::iterator::end_tag);
+
+        current.raise_threshold_above(2);
+        auto actual = std::vector<std::pair<int, int>>(current, end);
+
+        auto expected = burst::make_vector({std::make_pair(1, 1), std::make_pair(4, 3)});
+        BOOST_CHECK(actual == expected);
+    }
+BOOST_AUTO_TEST_SUITE_END()